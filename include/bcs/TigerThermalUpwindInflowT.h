@@ -0,0 +1,51 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "IntegratedBC.h"
+
+/**
+ * Upwind boundary flux of a constant monomial (cell-centred finite volume)
+ * temperature variable: on inflow sides the boundary element receives
+ * |v.n| (temperature - value), outflow sides are left free.
+ */
+class TigerThermalUpwindInflowT : public IntegratedBC
+{
+public:
+  static InputParameters validParams();
+  TigerThermalUpwindInflowT(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  // temperature of the inflowing fluid (controllable)
+  const Real & _value;
+
+  // imported props
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<Real> & _rho_f;
+  const MaterialProperty<Real> & _cp_f;
+  const MaterialProperty<RealVectorValue> & _av;
+};
@@ -0,0 +1,53 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "DGKernel.h"
+#include "RankTwoTensor.h"
+
+/**
+ * Two-point flux approximation of the diffusion and dispersion between the
+ * elements of a constant monomial (cell-centred finite volume) solute
+ * variable, using the harmonic mean of n.K.n of both sides and the distance
+ * of the element centroids along the side normal.
+ */
+class TigerSoluteTPFADGKernelS : public DGKernel
+{
+public:
+  static InputParameters validParams();
+  TigerSoluteTPFADGKernelS(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual(Moose::DGResidualType type) override;
+  virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
+
+  // transmissibility per unit side area
+  Real transmissibility() const;
+
+  // imported props on both sides
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<Real> & _scale_factor_neighbor;
+  const MaterialProperty<RankTwoTensor> & _coeff;
+  const MaterialProperty<RankTwoTensor> & _coeff_neighbor;
+};
@@ -0,0 +1,47 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "DGKernel.h"
+
+/**
+ * First-order upwind flux of the solute advection v.grad(c) across the
+ * internal sides of a constant monomial (cell-centred finite volume) solute
+ * variable: each element receives |v.n| (c - c_upwind) over its inflow sides.
+ */
+class TigerSoluteUpwindDGKernelS : public DGKernel
+{
+public:
+  static InputParameters validParams();
+  TigerSoluteUpwindDGKernelS(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual(Moose::DGResidualType type) override;
+  virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
+
+  // imported props on both sides
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<RealVectorValue> & _av;
+  const MaterialProperty<RealVectorValue> & _av_neighbor;
+};
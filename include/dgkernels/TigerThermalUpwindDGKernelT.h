@@ -0,0 +1,59 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "DGKernel.h"
+
+/**
+ * First-order upwind flux of the thermal advection rho_f cp_f v.grad(T)
+ * across the internal sides of a constant monomial (cell-centred finite
+ * volume) temperature variable.
+ *
+ * Only sides shared by two elements carry a flux. A lower dimensional block
+ * (a well or fracture of TigerGeometryMaterial) shares no side with the rock
+ * matrix, so no heat is exchanged between them: a finite volume well is
+ * isolated from the matrix and only transports along itself.
+ */
+class TigerThermalUpwindDGKernelT : public DGKernel
+{
+public:
+  static InputParameters validParams();
+  TigerThermalUpwindDGKernelT(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual(Moose::DGResidualType type) override;
+  virtual Real computeQpJacobian(Moose::DGJacobianType type) override;
+
+  // volumetric heat capacity flux through the side, positive to the neighbor
+  Real sideFlux() const;
+
+  // imported props on both sides
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<Real> & _rho_f;
+  const MaterialProperty<Real> & _rho_f_neighbor;
+  const MaterialProperty<Real> & _cp_f;
+  const MaterialProperty<Real> & _cp_f_neighbor;
+  const MaterialProperty<RealVectorValue> & _av;
+  const MaterialProperty<RealVectorValue> & _av_neighbor;
+};
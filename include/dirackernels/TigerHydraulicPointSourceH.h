@@ -44,9 +44,12 @@ public:
   virtual void addPoints() override;
   virtual Real computeQpResidual() override;
 
+  // location of the well point (used by TigerParticleTracker)
+  const Point & point() const { return _p; }
+
 protected:
-  // userdefined constant mass flux (kg/s)
-  const Real _mass_flux;
+  // userdefined constant mass flux (kg/s), controllable
+  const Real & _mass_flux;
   // The location of the point source (sink)
   const Point _p;
   // The time at which the point source (sink) starts operating
@@ -0,0 +1,55 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+
+#pragma once
+
+#include "Steady.h"
+#include "TigerAdjoint.h"
+
+/**
+ * Steady executioner with discrete adjoint sensitivities. After the forward
+ * solve, every observable J (a variable at a point, e.g. the produced
+ * temperature or pressure at a well) is differentiated with respect to
+ * controllable real parameters m (e.g. k0 of a Tiger permeability user
+ * object or lambda of TigerThermalMaterialT):
+ *   A^T psi = dJ/du,   dJ/dm = -psi . dR/dm
+ * with the Jacobian A of the converged state, assembled once for all
+ * observables, and dR/dm from central differences of the residual, i.e.
+ * one transposed linear solve per observable and two residual evaluations
+ * per parameter. With verify = true the sensitivities are checked against
+ * finite differences of full forward solves.
+ */
+class TigerAdjointSteady : public Steady
+{
+public:
+  static InputParameters validParams();
+  TigerAdjointSteady(const InputParameters & parameters);
+
+  virtual void execute() override;
+
+protected:
+  // forward solve from a given initial guess, false if it failed
+  bool forwardSolve(const NumericVector<Number> & guess);
+
+  // observables, parameters and adjoint solves
+  TigerAdjoint _adjoint;
+};
@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+
+#pragma once
+
+#include "Transient.h"
+#include "TigerAdjoint.h"
+
+#include <map>
+
+/**
+ * Transient (implicit Euler) executioner with discrete adjoint sensitivities
+ * of point observables at the end time to controllable parameters. With the
+ * step residuals R_n(u_n, u_{n-1}, m), A_n = dR_n/du_n and
+ * B_n = dR_n/du_{n-1}, the backward sweep solves
+ *   A_N^T psi_N = dJ/du,   A_n^T psi_n = -B_{n+1}^T psi_{n+1}
+ * and sums dJ/dm = -sum_n psi_n . dR_n/dm. A_n is the Jacobian of step n,
+ * B_n = -(time kernel Jacobian at a zero rate), which is exact for time
+ * kernels linear in the rate (all Tiger time kernels); rows of nodal BCs do
+ * not depend on u_{n-1}.
+ *
+ * At most max_checkpoints forward states are kept at any time (besides the
+ * working vectors of the step in the sweep). The forward run keeps them at
+ * a regular step interval, which doubles (and every other checkpoint is
+ * dropped) whenever the limit is reached. The sweep releases the states it
+ * has passed and recomputes a missing state from the checkpoint before it,
+ * spreading the free slots over the recomputed steps. Fewer checkpoints
+ * cost more recomputed steps (up to N^2 / 2 with two), never more memory.
+ */
+class TigerAdjointTransient : public Transient
+{
+public:
+  static InputParameters validParams();
+  TigerAdjointTransient(const InputParameters & parameters);
+
+  virtual void preExecute() override;
+  virtual void postStep() override;
+  virtual void execute() override;
+
+protected:
+  // keeps the current solution as state n if it falls on a checkpoint
+  void checkpoint(unsigned int n);
+  // forward state of step n, recomputed from the last checkpoint if needed
+  const NumericVector<Number> & state(unsigned int n);
+  // drops the checkpoints of step n and later (but not the initial state)
+  void release(unsigned int n);
+  // sets time, time step, current and old solution of step n
+  void setStep(unsigned int n, const NumericVector<Number> & u, const NumericVector<Number> & u_old);
+  // solves step n from the state of step n - 1, false if it failed
+  bool solveStep(unsigned int n, const NumericVector<Number> & u_old);
+  // local dofs of nodal boundary conditions
+  void nodalBCDofs();
+
+  // observables, parameters and adjoint solves
+  TigerAdjoint _adjoint;
+  // limit of the kept checkpoints (0 keeps every state)
+  const unsigned int _max_checkpoints;
+  unsigned int _interval;
+  // times and time steps of the accepted steps, step 0 is the initial state
+  std::vector<Real> _times;
+  std::vector<Real> _dts;
+  // checkpointed states, counted against max_checkpoints
+  std::map<unsigned int, std::unique_ptr<NumericVector<Number>>> _checkpoints;
+  // recomputed steps and the largest number of kept states
+  unsigned int _n_recomputed;
+  unsigned int _max_kept;
+  // dofs whose residual rows do not depend on the old state
+  std::vector<dof_id_type> _bc_dofs;
+};
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "Executioner.h"
+
+#include "libmesh/numeric_vector.h"
+
+class TigerPararealMultiApp;
+
+/**
+ * Parareal (parallel in time) executioner. The time span is split into one
+ * slice per sub-app of a TigerPararealMultiApp. The problem of this input is
+ * the coarse propagator G (large coarse_dt, optionally lagged fluid
+ * properties), the sub-apps are the fine propagators F run concurrently on
+ * their own communicators. Every iteration corrects the slice states with
+ *   U_{n+1} = G(U_n) + F(U_n^old) - G(U_n^old)
+ * until the states, or a monitored postprocessor (e.g. the produced
+ * temperature), stop changing. Both propagators need the same mesh. The
+ * slice states are parallel vectors, each processor holds its share only.
+ */
+class TigerParareal : public Executioner
+{
+public:
+  static InputParameters validParams();
+  TigerParareal(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void execute() override;
+  virtual bool lastSolveConverged() const override { return _converged; }
+
+protected:
+  // coarse propagation of a state from slice n to n + 1
+  void coarse(unsigned int n, const NumericVector<Number> & initial,
+              NumericVector<Number> & final);
+  // monitored postprocessor of this problem for a state at time t
+  Real monitor(const NumericVector<Number> & state, Real t);
+
+  // time span and time steps of the propagators
+  const Real _start_time;
+  const Real _end_time;
+  const Real _coarse_dt;
+  const Real _fine_dt;
+  // iteration control
+  unsigned int _max_its;
+  const Real _tol;
+  const Real _monitor_tol;
+  // fine propagators
+  TigerPararealMultiApp * _fine;
+  // number of slices and length of one state
+  unsigned int _n_slices;
+  std::size_t _size;
+  // states at the slice starts (and end), coarse and fine results per slice
+  std::vector<std::unique_ptr<NumericVector<Number>>> _U;
+  std::vector<std::unique_ptr<NumericVector<Number>>> _G;
+  std::vector<std::unique_ptr<NumericVector<Number>>> _F;
+  bool _converged;
+};
@@ -0,0 +1,58 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "Transient.h"
+
+/**
+ * Transient executioner used to reach a steady state by pseudo-time
+ * stepping with the Tiger time kernels. After every converged step the steady
+ * residual (all but the time kernels) of the new state is measured; the run
+ * stops once it has dropped below the tolerances. TigerSERTimeStepper uses
+ * the same residuals to grow the pseudo time step.
+ */
+class TigerPseudoTransient : public Transient
+{
+public:
+  static InputParameters validParams();
+  TigerPseudoTransient(const InputParameters & parameters);
+
+  virtual void postStep() override;
+  virtual bool keepGoing() override;
+
+  // L2 norm of the steady residual after the last and the one but last converged steps
+  Real steadyResidual() const { return _res; }
+  Real steadyResidualOld() const { return _res_old; }
+
+protected:
+  // termination tolerances of the steady residual
+  const Real _steady_rel_tol;
+  const Real _steady_abs_tol;
+  // steady residuals and the reference of the relative tolerance (first step)
+  Real _res;
+  Real _res_old;
+  Real _res_ref;
+  // steady state reached
+  bool _steady;
+};
@@ -0,0 +1,55 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "TimeKernel.h"
+
+/**
+ * Fixed-stress stabilisation of the pressure equation when the mechanics is
+ * solved separately: the change of volumetric strain between two coupling
+ * iterations is estimated from the pressure change at fixed mean stress,
+ * adding (b^2 / K_dr) (p - p_k) / dt with p_k the pressure of the previous
+ * iteration and K_dr the drained bulk modulus.
+ */
+class TigerFixedStressKernelHM : public TimeKernel
+{
+public:
+  static InputParameters validParams();
+  TigerFixedStressKernelHM(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+  // b^2 / K_dr
+  Real stabilisation() const;
+
+  // pressure of the previous coupling iteration
+  const VariableValue & _p_k;
+  // user defined drained bulk modulus (zero if taken from the materials)
+  const Real _K_dr;
+
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<Real> & _biot;
+  const MaterialProperty<Real> & _solid_bulk;
+};
@@ -37,9 +37,17 @@ public:
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
+  virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
 
   const MaterialProperty<Real> & _scale_factor;
   const MaterialProperty<Real> & _H_Kernel_dt;
+  // storage changes through porosity evolution
+  const MaterialProperty<Real> & _beta_f;
+  const MaterialProperty<Real> & _dn_dp;
+  const MaterialProperty<Real> & _dn_dT;
+  const MaterialProperty<Real> & _dn_dev;
+  unsigned int _temperature_var;
+  std::vector<unsigned int> _disp_var;
 };
 
 #endif // TIGERHYDRAULICTIMEKERNELH_H
@@ -38,6 +38,8 @@ protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
+  // derivative of the Darcy flux term wrt porosity
+  Real dFluxdPorosity() const;
 
   const MaterialProperty<Real> & _scale_factor;
   const MaterialProperty<RankTwoTensor> & _k_vis;
@@ -49,6 +51,13 @@ protected:
   const MaterialProperty<Real> & _dmu_dT_f;
   const MaterialProperty<RealVectorValue> & _g;
   const MaterialProperty<Real> & _vol_strain_rate;
+  const MaterialProperty<Real> & _dvol_strain_rate;
+  // permeability and porosity changes for the Jacobian
+  const MaterialProperty<Real> & _dlnk_dn;
+  const MaterialProperty<Real> & _dn_dp;
+  const MaterialProperty<Real> & _dn_dT;
+  const MaterialProperty<Real> & _dn_dev;
   unsigned int _temperature_var;
-  std::vector<unsigned int> _disp;
+  // displacement variable numbers
+  std::vector<unsigned int> _disp_var;
 };
@@ -0,0 +1,52 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "ArrayKernel.h"
+#include "RankTwoTensor.h"
+
+/**
+ * Diffusion and dispersion of all species of an array concentration variable.
+ * The mechanical dispersion is shared, the diffusive part is scaled by the
+ * molecular diffusion of each species. Requires TigerSoluteMaterialS with
+ * multi_species = true.
+ */
+class TigerSoluteArrayDiffusionKernelS : public ArrayKernel
+{
+public:
+  static InputParameters validParams();
+  TigerSoluteArrayDiffusionKernelS(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpResidual(RealEigenVector & residual) override;
+  virtual RealEigenVector computeQpJacobian() override;
+
+  // molecular diffusion of each species
+  RealEigenVector _diffusion;
+
+  // imported props from materials
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<RankTwoTensor> & _dispersion;
+  const MaterialProperty<RankTwoTensor> & _diffusion_unit;
+};
@@ -38,10 +38,18 @@ public:
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
+  // diffusion and dispersion of the matrix-free mode applied to a gradient
+  Real applyDispersion(const RealVectorValue & grad) const;
+
+  // apply the dispersion without the tensor (as the material provides it)
+  const bool _matrix_free;
 
   // imported props from materials
   const MaterialProperty<Real> & _scale_factor;
-  const MaterialProperty<RankTwoTensor> & _diffdisp;
+  const MaterialProperty<RankTwoTensor> * _diffdisp;
+  const MaterialProperty<Real> * _disp_iso;
+  const MaterialProperty<Real> * _disp_dir;
+  const MaterialProperty<RealVectorValue> * _av;
 };
 
 #endif // TIGERSOLUTEDIFFUSIONKERNELS_H
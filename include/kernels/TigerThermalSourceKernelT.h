@@ -25,6 +25,7 @@
 #define TIGERTHERMALSOURCEKERNELT_H
 
 #include "Kernel.h"
+#include "TigerQpFunctionCache.h"
 
  
 class Function;
@@ -38,10 +39,13 @@ public:
   TigerThermalSourceKernelT(const InputParameters & parameters);
 
 protected:
+  virtual void precalculateResidual() override;
   virtual Real computeQpResidual() override;
 
   const Real & _scale;
   const Function & _function;
+  // Heat source function sampled on the quadrature points
+  TigerQpFunctionCache _function_cache;
 
   // imported props from materials
   const MaterialProperty<Real> & _scale_factor;
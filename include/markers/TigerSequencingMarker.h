@@ -0,0 +1,48 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "Marker.h"
+
+/**
+ * Mesh sequencing: the first time steps (or the first solve of a steady
+ * problem with Adaptivity steps) run on the coarse input mesh, after which
+ * every element is refined uniformly, one level per adaptivity pass, until
+ * the production level is reached. The solution is projected by the
+ * adaptivity system and serves as the warm start on the fine mesh.
+ */
+class TigerSequencingMarker : public Marker
+{
+public:
+  static InputParameters validParams();
+  TigerSequencingMarker(const InputParameters & parameters);
+
+protected:
+  virtual MarkerValue computeElementMarker() override;
+
+  // refinement levels of the production mesh above the input mesh
+  const unsigned int _levels;
+  // time steps solved on the coarse mesh
+  const int _coarse_steps;
+};
@@ -27,6 +27,10 @@
 #include "Material.h"
 #include "SinglePhaseFluidProperties.h"
 
+#include "TigerSolutionStateCache.h"
+
+#include <unordered_map>
+
  
 
 class TigerFluidMaterial : public Material
@@ -35,8 +39,32 @@ public:
   static InputParameters validParams();
   TigerFluidMaterial(const InputParameters & parameters);
 
+  // number of quadrature points clamped since the last reset
+  unsigned long outOfRangeCount() const { return _n_out_of_range; }
+  void resetOutOfRangeCount() { _n_out_of_range = 0; }
+
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
+  // interpolates the properties evaluated at the nodes of the element
+  void computeNodalProperties();
+
+  // fluid properties of one pressure and temperature state
+  struct FluidState
+  {
+    Real rho, drho_dp, drho_dT, mu, dmu_dp, dmu_dT, cp, lambda;
+  };
+  // evaluates the equation of state (where is only used in messages)
+  void evaluate(Real pressure, Real temperature, const Point & where, FluidState & s);
+  // evaluates at the old state and checks the lag error against the current one
+  void evaluateLagged(Real pressure_old, Real temperature_old, Real pressure,
+                      Real temperature, const Point & where, FluidState & s);
+  // applies the out of range policy to pressure and temperature
+  void boundState(Real & pressure, Real & temperature, const Point & where);
 
   // Pore pressure nonlinear variable
   const VariableValue & _P;
@@ -44,6 +72,42 @@ protected:
   const VariableValue & _T;
   // Userobject from fluid_properties_module for calculating fluid properties
   const SinglePhaseFluidProperties & _fp_uo;
+  // physical bounds of pressure and temperature
+  const Real _p_min;
+  const Real _p_max;
+  const Real _T_min;
+  const Real _T_max;
+  // policy for states out of the bounds
+  enum class OutOfRange {clamp, cut_step, error};
+  const OutOfRange _policy;
+  // number of clamped quadrature points (reported by TigerFluidRangeViolations)
+  unsigned long _n_out_of_range;
+
+  // properties evaluated at the nodes and interpolated to the qps
+  const bool _nodal;
+  // nodal values of pressure and temperature (NULL if not coupled)
+  const VariableValue * _P_dofs;
+  const VariableValue * _T_dofs;
+  // shape functions of the coupled nodal variable
+  const VariablePhiValue * _phi;
+  // nodal states of the current iterate on this thread
+  std::unordered_map<dof_id_type, FluidState> _nodal_states;
+  std::vector<const FluidState *> _elem_states;
+
+  // properties evaluated at the state of the previous time step
+  const bool _lagged;
+  // relative density and viscosity difference failing a lagged step
+  const Real _lag_tol;
+  // old values of pressure and temperature (NULL if not lagged)
+  const VariableValue * _P_old;
+  const VariableValue * _T_old;
+  const VariableValue * _P_dofs_old;
+  const VariableValue * _T_dofs_old;
+  // lagging is switched off for a repeated time step
+  bool _lag_now;
+  int _setup_step;
+  // properties per element and solution state (NULL if not cached)
+  std::unique_ptr<TigerSolutionStateCache> _state_cache;
 
   // Density of the fluid
   MaterialProperty<Real> & _rho_f;
@@ -26,6 +26,7 @@
 
 #include "Material.h"
 #include "RankTwoTensor.h"
+#include "TigerQpFunctionCache.h"
 
  
 
@@ -36,6 +37,7 @@ public:
   TigerGeometryMaterial(const InputParameters & parameters);
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
   // Calculates rotation matrix for lower dimensional elements
   RankTwoTensor lowerDRotationMatrix(int dim);
@@ -50,6 +52,8 @@ protected:
   MaterialProperty<Real> & _scale_factor;
   // Initial scaling factor
   const Function & _scale_factor0;
+  // Scale factor sampled on the quadrature points
+  TigerQpFunctionCache _scale_cache;
   
 private:
   // Gravity vector
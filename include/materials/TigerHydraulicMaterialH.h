@@ -21,10 +21,13 @@
 /*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
 /**************************************************************************/
 
+#pragma once
 
 #include "Material.h"
 #include "RankTwoTensor.h"
 #include "TigerPermeability.h"
+#include "TigerQpFunctionCache.h"
+#include "TigerSolutionStateCache.h"
 
 class TigerHydraulicMaterialH : public Material
 {
@@ -34,6 +37,7 @@ public:
   TigerHydraulicMaterialH(const InputParameters & parameters);
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
   // Gradient of pressure
@@ -43,10 +47,10 @@ protected:
   MaterialProperty<RankTwoTensor> & _k_vis;
   // Hydraulic time derivative coefficient
   MaterialProperty<Real> & _H_Kernel_dt;
+  // relative change of permeability with porosity (Kozeny-Carman)
+  MaterialProperty<Real> & _dlnk_dn;
   // Tiger permeability calculater userobject
   const TigerPermeability & _kf_uo;
-  // Permeability vector filled with functions
-  std::vector<const Function *> _perm_vector;
   // Darcy velocity
   MaterialProperty<RealVectorValue> & _dv;
   // Derivative of Dracy velocity wrt temperature
@@ -75,7 +79,12 @@ protected:
 private:
   // Compressibility of the solid phase
   Real _beta_s;
-  // Permeability vector filled from functional input
+  // Initial permeability functions sampled on the quadrature points
+  TigerQpFunctionCache _perm_cache;
+  // properties per element and solution state (NULL if not cached)
+  std::unique_ptr<TigerSolutionStateCache> _state_cache;
+  // initial permeability from functional input at the current qp (empty
+  // without functions), refilled in place
   std::vector<Real> _kinit;
 
 };
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "Material.h"
+#include "TigerQpFunctionCache.h"
 
 class TigerMechanicsMaterialM : public Material
 {
@@ -32,6 +33,7 @@ public:
   TigerMechanicsMaterialM(const InputParameters & parameters);
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
   // biot coefficient for poromechanics
@@ -46,18 +48,26 @@ protected:
   std::vector<const VariableGradient *> _grad_disp_old;
   /// The volumetric strain rate at the quadpoints
   MaterialProperty<Real> & _vol_strain_rate;
+  /// Derivative of the volumetric strain rate wrt the volumetric strain
+  MaterialProperty<Real> & _dvol_strain_rate;
   /// The total volumetric strain at the quadpoints
   MaterialProperty<Real> & _vol_total_strain;
   // The strain and strain rate from Tensormechanics action
   const std::string _base_name;
-  const MaterialProperty<RankTwoTensor> & _TenMech_total_strain;
+  const MaterialProperty<RankTwoTensor> * _TenMech_total_strain;
+  // Volumetric strain of a separate mechanics solve (fixed-stress split)
+  const VariableValue * _vol_strain;
+  const VariableValue * _vol_strain_old;
   const MaterialProperty<RankTwoTensor> * _TenMech_strain_rate;
   // Extra stresses added to TensorMechanics action
-   std::vector<const Function *> _extra_stress;
    MaterialProperty<RankTwoTensor> & _TenMech_extra_stress;
+   // Extra stress functions sampled on the quadrature points
+   TigerQpFunctionCache _stress_cache;
 
 private:
   const Real _b;
   const Real _bu;
   bool _incremental;
+  // volumetric strain coupled instead of taken from TensorMechanics
+  const bool _split;
 };
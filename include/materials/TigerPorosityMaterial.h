@@ -48,6 +48,10 @@ protected:
   MaterialProperty<Real> & _mass_frac;
   // calculated porosity
   MaterialProperty<Real> & _n;
+  // derivatives of porosity wrt pressure, temperature and volumetric strain
+  MaterialProperty<Real> & _dn_dp;
+  MaterialProperty<Real> & _dn_dT;
+  MaterialProperty<Real> & _dn_dev;
   // Initial porosity
   const VariableValue & _n0;
   // Volumetric thermal expansion
@@ -69,6 +73,9 @@ protected:
 
 private:
   const bool _p_e;
+  // whether pressure and temperature are coupled for the derivatives
+  const bool _p_coupled;
+  const bool _T_coupled;
   const Real _rho_r;
   Real _alpha_t;
   bool _ev_type;
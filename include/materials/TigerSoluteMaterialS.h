@@ -28,6 +28,7 @@
 #include "Material.h"
 #include "TigerSUPG.h"
 #include "Function.h"
+#include "TigerSolutionStateCache.h"
 
  
 
@@ -47,12 +48,17 @@ private:
   bool _has_supg;
   // userdefined factor to manually modify upwinding coefficient
   Real _supg_scale;
+  // upwinding evaluated once per element instead of at every qp
+  bool _supg_centroid;
   // userdefined velocity vector function for advection
   const Function * _vel_func;
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
-  RankTwoTensor DispersionTensorCalculator(const RealVectorValue & darcy_v, Real const & dispersion_l, Real const & dispersion_tr, int dim, int dimMesh, Real diffusion_factor);
+  // upwinding of the whole element from the accumulated velocity and diffusivity
+  void elementSUPG();
+  RankTwoTensor DispersionTensorCalculator(const RealVectorValue & darcy_v, Real const & dispersion_l, Real const & dispersion_tr, int dim, int dimMesh, Real diffusion_factor) const;
 
   // Peclet number upon request
   MaterialProperty<Real> * _Pe;
@@ -78,6 +84,10 @@ protected:
 
   // userobject to calculate upwinding
   const TigerSUPG * _supg_uo;
+  // JxW weighted sums of velocity, diffusivity and weights for elementSUPG
+  RealVectorValue _supg_v;
+  Real _supg_diff;
+  Real _supg_w;
 
   // molecular diffusion as input parameter
   Real _diffusion_molecular;
@@ -86,22 +96,33 @@ protected:
   Real _disp_t;
   // Formation factor
   Real _formation_factor;
-  // Tensors for internal calculation, will be transferred
-  RankTwoTensor _dispersion_ten = RankTwoTensor();
-  RankTwoTensor _diffusion_ten = RankTwoTensor();
+  // split dispersion and diffusion for the multi-species kernels
+  bool _multi_species;
+  // dispersion applied to the gradients without forming the tensor
+  bool _matrix_free;
+  // minimum size of the current element
+  Real _h_min;
   // Tensor for Handover to the Kernels and output as AuxVariables
-  MaterialProperty<RankTwoTensor> & _dispersion_tensor;
+  MaterialProperty<RankTwoTensor> * _dispersion_tensor;
+  // Diffusion tensor per unit molecular diffusion (multi-species only)
+  MaterialProperty<RankTwoTensor> * _diffusion_unit;
   // Relativ Diffusion depending on porosity
   MaterialProperty<Real> & _diffusion_factor;
 
   // Tensor for Handover of combined diffusion and dispersion to Kernels
-  MaterialProperty<RankTwoTensor> & _diffdisp;
+  MaterialProperty<RankTwoTensor> * _diffdisp;
+  // isotropic and directional (v v^T) coefficients of the matrix-free mode
+  MaterialProperty<Real> * _disp_iso;
+  MaterialProperty<Real> * _disp_dir;
 
   // Neumann number Fo
   MaterialProperty<Real> & _Fo;
   // Peclet number
   MaterialProperty<Real> & _PeDisp;
 
+  // properties per element and solution state (NULL if not cached)
+  std::unique_ptr<TigerSolutionStateCache> _state_cache;
+
 };
 
 #endif /* TIGERSOLUTEMATERIALS_H */
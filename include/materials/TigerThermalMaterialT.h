@@ -28,6 +28,8 @@
 #include "RankTwoTensor.h"
 #include "TigerSUPG.h"
 #include "Function.h"
+#include "TigerQpFunctionCache.h"
+#include "TigerSolutionStateCache.h"
 
  
 
@@ -48,8 +50,8 @@ private:
   enum M {arithmetic, geometric};
   MooseEnum _mean;
 
-  // initial thermal conductivity for solid phase
-  std::vector<Real> _lambda0;
+  // initial thermal conductivity for solid phase (controllable)
+  const std::vector<Real> & _lambda0;
   // initial specific heat for solid phase
   Real _cp0;
   // initial density for solid phase
@@ -59,13 +61,27 @@ private:
   bool _has_supg;
   // userdefined factor to manually modify upwinding coefficient
   Real _supg_scale;
+  // upwinding evaluated once per element instead of at every qp
+  bool _supg_centroid;
   // userdefined velocity vector function for advection
   const Function * _vel_func;
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
-  RankTwoTensor Ari_Cond_Calc(Real const & n, Real const & lambda_f, const std::vector<Real> & lambda_s, const int & dim);
-  RankTwoTensor Geo_Cond_Calc(Real const & n, Real const & lambda_f, const std::vector<Real> & lambda_s, const int & dim);
+  // upwinding of the whole element from the accumulated velocity and diffusivity
+  void elementSUPG();
+  // mixture conductivity builders specialised by dimension and distribution type
+  template <unsigned int dim, CT ct>
+  RankTwoTensor arithmeticMean(Real n, Real lambda_f, const std::vector<Real> & lambda_s) const;
+  template <unsigned int dim, CT ct>
+  RankTwoTensor geometricMean(Real n, Real lambda_f, const std::vector<Real> & log_lambda_s) const;
+  // weight times the logarithm of a conductivity, zero for a zero weight
+  static Real weightedLog(Real w, Real log_lambda);
+  // chooses the builders of all element dimensions once at setup
+  void setConductivityBuilders();
+  // reports a wrong number of conductivity components for the given dimension
+  void conductivityError(unsigned int dim, unsigned int n) const;
 
   // Peclet number upon request
   MaterialProperty<Real> * _Pe;
@@ -107,6 +123,25 @@ protected:
 
   // userobject to calculate upwinding
   const TigerSUPG * _supg_uo;
+  // JxW weighted sums of velocity, diffusivity and weights for elementSUPG
+  RealVectorValue _supg_v;
+  Real _supg_diff;
+  Real _supg_w;
+
+  // functions multiplying the solid conductivity sampled on the quadrature points
+  TigerQpFunctionCache _lambda_cache;
+  // thermal conductivity for solid phase scaled by the lambda functions
+  std::vector<Real> _lambda;
+  // logarithm of the solid conductivity for geometric mean and the values it was taken of
+  std::vector<Real> _log_lambda;
+  std::vector<Real> _logged_lambda;
+  // properties per element and solution state (NULL if not cached)
+  std::unique_ptr<TigerSolutionStateCache> _state_cache;
+
+  typedef RankTwoTensor (TigerThermalMaterialT::*ConductivityBuilder)(Real n, Real lambda_f, const std::vector<Real> & lambda_s) const;
+  // conductivity builders and their number of components per element dimension
+  ConductivityBuilder _cond_builder[4];
+  unsigned int _n_lambda[4];
 };
 
 #endif /* TIGERTHERMALMATERIALT_H */
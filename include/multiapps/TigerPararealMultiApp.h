@@ -0,0 +1,50 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "FullSolveMultiApp.h"
+
+#include "libmesh/numeric_vector.h"
+
+/**
+ * Fine propagators of TigerParareal: one sub-app per time slice, distributed
+ * over sub-communicators like any MultiApp. The apps are only run slice by
+ * slice through runSlice, never by the usual MultiApp execution.
+ */
+class TigerPararealMultiApp : public FullSolveMultiApp
+{
+public:
+  static InputParameters validParams();
+  TigerPararealMultiApp(const InputParameters & parameters);
+
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+
+  // sets the initial state of a slice on its app; collective on the
+  // communicator of the state, also where the app is not local
+  void setSlice(unsigned int app, const NumericVector<Number> & initial);
+  // propagates a slice from t0 to t1 on its app (nothing if it is not local)
+  void runSlice(unsigned int app, Real t0, Real t1, Real dt);
+  // writes the final state of a slice; collective as setSlice
+  void getSlice(unsigned int app, NumericVector<Number> & final);
+};
@@ -0,0 +1,55 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "FieldSplitPreconditioner.h"
+
+/**
+ * Field split preconditioner for large permeability contrasts. Every dof of
+ * the lower dimensional blocks (wells and fractures, as seen by
+ * TigerGeometryMaterial) and of any listed conductive blocks forms one split
+ * that is solved directly. The remaining dofs, the complement, form the rock
+ * matrix split that is treated by algebraic multigrid: the nodes the wells
+ * share with the matrix belong to the conductive split only, so the matrix
+ * operator handed to multigrid holds no conductive entries. The contrast
+ * still acts through the coupling of the splits; preconditioning/benchmark.sh
+ * measures how the iteration counts depend on it.
+ */
+class TigerContrastPreconditioner : public FieldSplitPreconditioner
+{
+public:
+  static InputParameters validParams();
+  TigerContrastPreconditioner(const InputParameters & parameters);
+
+  // sets the index sets of the splits once the dofs are distributed
+  virtual void initialSetup() override;
+
+protected:
+  // adds one of the splits to the nonlinear system
+  void addSplit(const std::string & name, const std::vector<SubdomainName> & blocks,
+                const MultiMooseEnum & options, const std::vector<std::string> & values);
+
+  // blocks of the conductive split
+  std::set<SubdomainID> _conductive;
+};
@@ -0,0 +1,54 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "Predictor.h"
+
+/**
+ * Newton initial guess extrapolated from the last three time steps with a
+ * quadratic (Lagrange) polynomial in time, with unequal steps. As long as
+ * only two steps are available, e.g. at the start or after a failed step,
+ * the extrapolation is linear like in SimplePredictor.
+ */
+class TigerQuadraticPredictor : public Predictor
+{
+public:
+  static InputParameters validParams();
+  TigerQuadraticPredictor(const InputParameters & parameters);
+
+  virtual void timestepSetup() override;
+  virtual void apply(NumericVector<Number> & sln) override;
+
+protected:
+  // solution two steps before the old one and the older solution of the last setup
+  NumericVector<Number> & _solution_oldest;
+  NumericVector<Number> & _solution_older_prev;
+  // time step before the old one and the old time step of the last setup
+  Real _dt_older;
+  Real _dt_old_prev;
+  // time step of the last setup, repeated steps keep the history
+  int _setup_step;
+  // the oldest solution belongs to the current history
+  bool _has_oldest;
+};
@@ -0,0 +1,53 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "TimeStepper.h"
+
+class TigerPseudoTransient;
+
+/**
+ * Switched evolution relaxation (SER): the pseudo time step grows with the
+ * drop of the steady residual between two converged steps,
+ * dt_new = dt * (r_old / r)^exponent, limited by growth_factor.
+ */
+class TigerSERTimeStepper : public TimeStepper
+{
+public:
+  static InputParameters validParams();
+  TigerSERTimeStepper(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  // executioner measuring the steady residual
+  const TigerPseudoTransient * _pseudo;
+  // initial pseudo time step
+  const Real _dt0;
+  // largest growth per step
+  const Real _growth;
+  // exponent of the residual ratio
+  const Real _exponent;
+};
@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "LinearInterpolation.h"
+
+class SinglePhaseFluidProperties;
+
+/**
+ * Hydrostatic pressure and conductive temperature profile along the vertical
+ * axis. The temperature follows a constant gradient or a heat flow through
+ * layers of given conductivity; the pressure integrates dp/dd = rho(p, T) g
+ * with the density of the fluid properties user object (RK4 over the depth
+ * d). The pressure is tabulated once and interpolated, e.g. by
+ * TigerHydrostaticIC.
+ */
+class TigerHydrostaticProfile : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  TigerHydrostaticProfile(const InputParameters & parameters);
+
+  virtual void execute() override {}
+  virtual void initialize() override {}
+  virtual void finalize() override {}
+
+  // pressure and temperature at the given elevation
+  Real pressure(Real z) const;
+  Real temperature(Real z) const;
+  // coordinate component of the vertical axis
+  unsigned int component() const { return _component; }
+  // elevation of a point, checked against the range of the profile
+  Real elevation(const Point & p) const;
+
+protected:
+  // integrates the pressure over the depth
+  void tabulate();
+
+  const SinglePhaseFluidProperties & _fp_uo;
+  const unsigned int _component;
+  const Real _top;
+  const Real _bottom;
+  const Real _p0;
+  const Real _T0;
+  const Real _g;
+  const unsigned int _intervals;
+
+  // temperature gradient (K/m) or heat flow (W/m^2) through layers
+  const bool _has_heat_flow;
+  const Real _gradient;
+  const Real _heat_flow;
+  std::vector<Real> _conductivity;
+  std::vector<Real> _interfaces;
+
+  // tabulated pressure over the elevation
+  LinearInterpolation _pressure;
+};
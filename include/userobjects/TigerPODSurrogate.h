@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "TigerPODModel.h"
+
+/**
+ * Reduced-order surrogate of a curve (e.g. doublet production temperature)
+ * trained from the CSV outputs of full Tiger runs, see TigerPODModel. The
+ * accuracy is checked by leave-one-out cross-validation on the training runs
+ * and optionally against further full-order validation runs; the evaluation
+ * time is benchmarked against the wall time of the full-order runs.
+ */
+class TigerPODSurrogate : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  TigerPODSurrogate(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void execute() override {}
+  virtual void initialize() override {}
+  virtual void finalize() override {}
+
+  // evaluates the curve for the given parameters
+  void evaluate(const std::vector<Real> & parameters, std::vector<Real> & curve) const;
+  // times of the curve points
+  const std::vector<Real> & times() const { return _times; }
+
+protected:
+  // reads the curves of the given files on the time points of the surrogate
+  void readCurves(const std::vector<FileName> & files,
+                  std::vector<std::vector<Real>> & curves,
+                  std::vector<Real> * run_times);
+  // maximum relative error of the model over the given runs
+  Real maxError(const TigerPODModel & model,
+                const std::vector<std::vector<Real>> & parameters,
+                const std::vector<std::vector<Real>> & curves) const;
+  // relative error of a curve in the maximum norm
+  Real error(const std::vector<Real> & curve, const std::vector<Real> & reference) const;
+  // leave-one-out cross-validation on the training runs
+  void crossValidate();
+  // measures the evaluation time and compares it to the full-order runs
+  void benchmark();
+
+  const std::string & _curve_name;
+  const std::string & _time_name;
+  const Real _energy;
+  const unsigned int _max_modes;
+  const Real _shape;
+
+  // parameters, curves and wall times of the training runs
+  std::vector<std::vector<Real>> _parameters;
+  std::vector<std::vector<Real>> _curves;
+  std::vector<Real> _run_times;
+  // time points of the curves
+  std::vector<Real> _times;
+
+  TigerPODModel _model;
+};
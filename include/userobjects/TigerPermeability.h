@@ -38,11 +38,39 @@ public:
   virtual void finalize();
 
   /// permeability matrix (m^2); called from Material
-  virtual RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> kmat) const = 0;
+  virtual RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> & kmat) const = 0;
+  /// derivative of log(permeability) wrt porosity for the Jacobian (1)
+  virtual Real dLogPermeability_dPorosity(const Real & /*porosity*/) const { return 0.0; }
+  /// controllable parameters the permeability depends on (NULL if there are none)
+  virtual const std::vector<Real> * controllableParameters() const { return NULL; }
 
 protected:
+  enum PT {isotropic, orthotropic, anisotropic};
+
+  // Selects the tensor builders of all element dimensions once at setup
+  void setPermeabilityType(const MooseEnum & permeability_type);
+  // Checks that the number of user given components fits an element dimension of the mesh
+  void checkComponents(const std::vector<Real> & k0) const;
+
   // Creates the permeability tensor as function of input and dimension
-  virtual RankTwoTensor PermeabilityTensorCalculator(const int & dim, const std::vector<Real> & k0, const MooseEnum & _permeability_type) const;
+  RankTwoTensor PermeabilityTensorCalculator(const int & dim, const std::vector<Real> & k0) const
+  {
+    if (k0.size() != _n_components[dim])
+      componentError(dim, k0.size());
+    return _builder[dim](k0);
+  }
 
-  enum PT {isotropic, orthotropic, anisotropic};
+private:
+  // Straight-line tensor builders specialised by dimension and distribution type
+  template <unsigned int dim, PT type>
+  static RankTwoTensor buildTensor(const std::vector<Real> & k0);
+
+  // Reports a wrong number of components for the given dimension
+  void componentError(unsigned int dim, unsigned int n) const;
+
+  typedef RankTwoTensor (*TensorBuilder)(const std::vector<Real> & k0);
+  // builders and their number of components per element dimension
+  TensorBuilder _builder[4];
+  unsigned int _n_components[4];
+  PT _type;
 };
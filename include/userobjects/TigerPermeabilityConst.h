@@ -33,10 +33,11 @@ public:
 
   TigerPermeabilityConst(const InputParameters & parameters);
 
-  RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> kmat) const;
+  RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> & kmat) const;
+  const std::vector<Real> * controllableParameters() const { return &_kinit; }
 
 protected:
-  // Permeability from user input
-  std::vector<Real> _kinit;
+  // Permeability from user input (controllable, e.g. for parameter sweeps)
+  const std::vector<Real> & _kinit;
   MooseEnum _permeability_type;
 };
@@ -33,7 +33,7 @@ class TigerPermeabilityCubicLaw : public TigerPermeability
 public:
   static InputParameters validParams();
   TigerPermeabilityCubicLaw(const InputParameters & parameters);
-  RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> kmat) const;
+  RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> & kmat) const;
 
 protected:
   // user defined aperture
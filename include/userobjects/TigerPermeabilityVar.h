@@ -33,7 +33,8 @@ public:
 
   TigerPermeabilityVar(const InputParameters & parameters);
 
-  RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> kmat) const;
+  RankTwoTensor Permeability(const int & dim, const Real & porosity, const Real & scale_factor, const std::vector<Real> & kmat) const;
+  Real dLogPermeability_dPorosity(const Real & porosity) const;
 
 protected:
   // Initial permeability from user input
@@ -0,0 +1,76 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "ElementUserObject.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+
+/**
+ * Estimates the magnitude of the Jacobian diagonal of pressure, temperature
+ * and displacements from the Tiger material properties (conduction-like
+ * coefficient times volume over h^2 plus storage times volume over dt) and
+ * sets the scaling factor of each variable to its inverse. MOOSE applies the
+ * factor to the residual and Jacobian rows of the variable.
+ */
+class TigerScalingEstimator : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+  TigerScalingEstimator(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  // sets the scaling factor of a variable on all threads
+  void applyScaling(const std::string & var, Real diagonal);
+
+  // names of the scaled variables
+  std::string _p_name;
+  std::string _T_name;
+  std::vector<std::string> _disp_names;
+
+  // refresh every this many time steps (0 only at the start)
+  const unsigned int _interval;
+  // whether the scaling is estimated at this execution
+  bool _active;
+  // whether no time step has begun in this run yet (not restored on recover)
+  bool _first_step;
+
+  // imported props from materials
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<RankTwoTensor> * _k_vis;
+  const MaterialProperty<Real> * _H_Kernel_dt;
+  const MaterialProperty<RankTwoTensor> * _lambda_sf;
+  const MaterialProperty<Real> * _TimeKernelT;
+  const MaterialProperty<RankFourTensor> * _elasticity;
+
+  // largest diagonal estimates of pressure, temperature and displacements
+  Real _diag_p;
+  Real _diag_T;
+  Real _diag_u;
+};
@@ -0,0 +1,77 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "ElementUserObject.h"
+
+class NonlinearSystemBase;
+
+/**
+ * Operator-split first-order decay and linear equilibrium sorption of a
+ * solute. After the transport solve the dissolved concentration of every node
+ * is updated analytically: the lumped dissolved mass (storage TimeKernel_S of
+ * TigerSoluteMaterialS) and the sorbed mass (bulk density times Kd, in
+ * equilibrium with the previous concentration) are re-equilibrated and decayed
+ * over the time step. The global system stays pure linear transport.
+ */
+class TigerSoluteReactionS : public ElementUserObject
+{
+public:
+  static InputParameters validParams();
+  TigerSoluteReactionS(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject &) override {}
+  virtual void finalize() override;
+
+protected:
+  // collects the local nodal dofs of the concentration variable
+  void localDofs();
+
+  MooseVariable & _var;
+  NonlinearSystemBase & _nl;
+
+  // first-order decay constant
+  const Real _decay;
+  // linear sorption distribution coefficient
+  const Real _kd;
+  // whether the sorbed mass decays as well
+  const bool _sorbed_decay;
+
+  // imported props from materials
+  const MaterialProperty<Real> & _scale_factor;
+  const MaterialProperty<Real> & _TimeKernelS;
+  const MaterialProperty<Real> * _rho_b;
+
+  // lumped dissolved and sorbed storage of each node
+  NumericVector<Number> & _storage;
+  NumericVector<Number> & _sorption;
+
+  // local nodal dofs and scratch for the batch update
+  std::vector<dof_id_type> _dofs;
+  std::vector<Number> _c, _c_old, _n, _k;
+};
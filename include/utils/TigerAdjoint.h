@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+
+#pragma once
+
+#include "InputParameters.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/sparse_matrix.h"
+#include "libmesh/linear_solver.h"
+
+#include <functional>
+
+class FEProblemBase;
+class MooseObject;
+class ConsoleStream;
+
+/**
+ * Observables, parameters and linear algebra shared by the adjoint
+ * executioners. Observables J are nonlinear variables at points (e.g. the
+ * produced temperature or pressure at a well), J = g . u; parameters m are
+ * the components of controllable real vector parameters (e.g. k0 of a Tiger
+ * permeability user object or lambda of TigerThermalMaterialT). The
+ * derivatives dR/dm are central differences of the residual at a fixed
+ * state, the adjoint solves use the PETSc options with the prefix -adjoint_.
+ */
+class TigerAdjoint
+{
+public:
+  static InputParameters validParams();
+  TigerAdjoint(MooseObject & owner, FEProblemBase & problem, const ConsoleStream & console);
+
+  // checks that the forward problem has an exact adjoint, called before the forward run
+  void check();
+
+  unsigned int nObservables() const { return _obs_vars.size(); }
+  unsigned int nParameters() const { return _par_names.size(); }
+
+  // gradient of an observable with respect to the nonlinear dofs
+  void observableGradient(unsigned int i, NumericVector<Number> & g);
+  // value of a parameter component and setting it
+  Real parameter(unsigned int p) const;
+  void setParameter(unsigned int p, Real value);
+  // dR/dm of a parameter component at the current solution, time and time step
+  void residualDerivative(unsigned int p, NumericVector<Number> & dR);
+  // solves A^T psi = rhs for the adjoint of observable i
+  void adjointSolve(SparseMatrix<Number> & A, NumericVector<Number> & psi,
+                    NumericVector<Number> & rhs, unsigned int i);
+  // console table and csv file of the sensitivities
+  void report(const std::vector<Real> & values, const std::vector<std::vector<Real>> & dJ_dm);
+  // checks the sensitivities against central differences of two forward runs
+  // per parameter if verify = true; forward(J) runs the model with the current
+  // parameters and returns the observables, false if it failed
+  void verify(const std::vector<std::vector<Real>> & dJ_dm,
+              const std::function<bool(std::vector<Real> &)> & forward);
+
+protected:
+  MooseObject & _owner;
+  FEProblemBase & _problem;
+  const ConsoleStream & _console;
+  // observables
+  const std::vector<VariableName> & _obs_vars;
+  const std::vector<Point> & _obs_points;
+  std::vector<std::string> _obs_names;
+  // controllable parameters and the component of every sensitivity
+  std::vector<std::string> _par_names;
+  std::vector<std::string> _par_params;
+  std::vector<unsigned int> _par_comps;
+  // relative step of the residual differences
+  const Real _fd_step;
+  // adjoint linear solver
+  const Real _adjoint_tol;
+  const unsigned int _adjoint_max_its;
+  std::unique_ptr<LinearSolver<Number>> _solver;
+  // finite difference verification
+  const bool _verify;
+  const Real _verify_step;
+  const Real _verify_tol;
+};
@@ -0,0 +1,84 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/point.h"
+
+#include <array>
+#include <string>
+
+/**
+ * Read-only access to a property given on a regular 3D grid. The values are
+ * stored as native double precision numbers (x index fastest, then y, then z)
+ * either in a raw binary file (the grid geometry is then given by the user)
+ * or after a short text header of the form
+ *
+ *   TIGER_GRID
+ *   dimensions nx ny nz
+ *   origin x0 y0 z0
+ *   spacing dx dy dz
+ *   end_header
+ *
+ * The file is memory-mapped, so only the pages that are actually interpolated
+ * (i.e. those covering the elements of the local process) are read from disk.
+ */
+class TigerGriddedData
+{
+public:
+  // opens a file with a text header
+  TigerGriddedData(const std::string & file_name);
+  // opens a raw binary file with the given grid geometry
+  TigerGriddedData(const std::string & file_name,
+                   const std::array<unsigned int, 3> & dimensions,
+                   const Point & origin,
+                   const std::array<Real, 3> & spacing);
+  ~TigerGriddedData();
+
+  TigerGriddedData(const TigerGriddedData &) = delete;
+  TigerGriddedData & operator=(const TigerGriddedData &) = delete;
+
+  // trilinear interpolation (clamped to the grid bounds) at the given point,
+  // optionally of log10 of the values (e.g. for log-normal permeability
+  // fields), which errors on a non-positive value at the nodes used
+  Real value(const Point & p, bool logarithmic = false) const;
+
+private:
+  // maps the file and checks its size against the grid dimensions
+  void map(std::size_t offset);
+  // value at the grid node (i, j, k)
+  Real node(unsigned int i, unsigned int j, unsigned int k) const;
+  // lower node index and weight of the upper node along one direction
+  void locate(unsigned int d, Real x, unsigned int & i, Real & w) const;
+
+  const std::string _file_name;
+  std::array<unsigned int, 3> _n;
+  Point _origin;
+  std::array<Real, 3> _spacing;
+
+  // mapped file and the start of the values in it
+  void * _map;
+  std::size_t _map_size;
+  const char * _data;
+};
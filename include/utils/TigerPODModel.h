@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/dense_matrix.h"
+
+/**
+ * Non-intrusive reduced-order model of a curve (e.g. production temperature
+ * over time) depending on a few parameters. The curves of the training runs
+ * are decomposed by a proper orthogonal decomposition (POD) of the snapshot
+ * matrix and the POD coefficients are interpolated in the parameter space by
+ * inverse multiquadric radial basis functions of the distance between
+ * parameters normalised by their training range.
+ */
+class TigerPODModel
+{
+public:
+  TigerPODModel();
+
+  // builds the model from the training parameters and curves (one row per run)
+  void train(const std::vector<std::vector<Real>> & parameters,
+             const std::vector<std::vector<Real>> & curves,
+             Real energy,
+             unsigned int max_modes,
+             Real shape);
+
+  // evaluates the curve for the given parameters
+  void evaluate(const std::vector<Real> & parameters, std::vector<Real> & curve) const;
+
+  // number of the retained POD modes
+  unsigned int numModes() const { return _n_modes; }
+
+private:
+  // radial basis function of the normalised distance
+  Real basis(Real r) const;
+  // normalised distance between the given parameters and a training run
+  Real distance(const std::vector<Real> & parameters, unsigned int run) const;
+
+  unsigned int _n_modes;
+  Real _shape;
+  // mean training curve
+  std::vector<Real> _mean;
+  // retained POD modes (curve points x modes)
+  DenseMatrix<Real> _modes;
+  // radial basis function weights (runs x modes)
+  DenseMatrix<Real> _weights;
+  // training parameters and their ranges for normalisation
+  std::vector<std::vector<Real>> _centers;
+  std::vector<Real> _range;
+};
@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseEnum.h"
+#include "MooseArray.h"
+#include "libmesh/elem.h"
+
+#include <unordered_map>
+
+class Function;
+
+/**
+ * Samples a set of Functions on the quadrature points of an element and keeps
+ * the values per element, so that spatially varying inputs (e.g. heterogeneous
+ * permeability fields) are not re-evaluated at every residual and Jacobian
+ * evaluation. Time-independent functions can be sampled once for the whole
+ * simulation and time-dependent ones once per time step. Objects holding a
+ * cache are duplicated per thread, so no locking is needed here.
+ */
+class TigerQpFunctionCache
+{
+public:
+  enum class Update
+  {
+    always,
+    timestep,
+    once
+  };
+
+  // MooseEnum of the update options for the input parameters of the users
+  static MooseEnum updateEnum();
+
+  TigerQpFunctionCache(const MooseEnum & update);
+
+  // adds a function to be sampled (component index follows the call order)
+  void addFunction(const Function & function);
+  // number of sampled functions
+  unsigned int size() const { return _functions.size(); }
+
+  // makes the values of the given element current (sampling them if needed)
+  void reinit(const Elem * elem, const MooseArray<Point> & q_point, Real t);
+  // value of the i-th function at the qp-th quadrature point of the current element
+  Real value(unsigned int qp, unsigned int i) const
+  {
+    return (*_current)[qp * _functions.size() + i];
+  }
+  // values of all functions (size() of them) at the qp-th quadrature point
+  // of the current element
+  const Real * values(unsigned int qp) const
+  {
+    return _current->data() + qp * _functions.size();
+  }
+
+  // drops all the sampled values (e.g. after the mesh changed)
+  void clear();
+
+private:
+  struct Entry
+  {
+    // time that the values were sampled at
+    Real _t = 0.0;
+    // first quadrature point to detect changes in the quadrature
+    Point _q0;
+    // values of all functions at the first quadrature point, then the next
+    std::vector<Real> _values;
+  };
+
+  // true if the entry has to be (re)sampled for the given quadrature and time
+  bool isOutdated(const Entry & entry, const MooseArray<Point> & q_point, Real t) const;
+  // samples all the functions on the given quadrature points
+  void sample(Entry & entry, const MooseArray<Point> & q_point, Real t);
+
+  const Update _update;
+  std::vector<const Function *> _functions;
+  // sampled values per element id
+  std::unordered_map<dof_id_type, Entry> _entries;
+  // storage used when sampling is not cached
+  Entry _scratch;
+  // values of the current element
+  const std::vector<Real> * _current;
+};
@@ -0,0 +1,57 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "MooseObject.h"
+#include "MooseTypes.h"
+#include "libmesh/vector_value.h"
+
+// helpers shared by the multi-species (array variable) solute kernels
+namespace TigerSoluteArray
+{
+/// per-species coefficients from a vector parameter, filled with def if unset
+inline RealEigenVector
+speciesCoefficients(const MooseObject & object, const std::string & name,
+                    unsigned int count, Real def)
+{
+  RealEigenVector c = RealEigenVector::Constant(count, def);
+  if (object.isParamValid(name))
+  {
+    const std::vector<Real> & v = object.getParam<std::vector<Real>>(name);
+    if (v.size() != count)
+      object.paramError(name, "one value per component of the variable (",
+                        count, ") is required");
+    for (unsigned int s = 0; s < count; ++s)
+      c(s) = v[s];
+  }
+  return c;
+}
+
+/// view of a libMesh vector as an Eigen column to multiply array gradients
+inline Eigen::Map<const Eigen::Matrix<Real, LIBMESH_DIM, 1>>
+eigen(const RealVectorValue & v)
+{
+  return Eigen::Map<const Eigen::Matrix<Real, LIBMESH_DIM, 1>>(&v(0));
+}
+}
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "MooseArray.h"
+#include "libmesh/elem.h"
+
+#include <unordered_map>
+
+class FEProblemBase;
+class MaterialData;
+class PropertyValue;
+
+/**
+ * Keeps the properties a material computed for every element together with
+ * the solution state they were computed from: the element's nonlinear and
+ * auxiliary dof indices and values, the time, the time step and the first
+ * quadrature point. As long as that state is unchanged, e.g. between the
+ * residual and the Jacobian of a Newton iterate, the stored properties are
+ * copied back instead of being recomputed. Any change of the solution, the
+ * time or the mesh makes the entry outdated. The values of watched
+ * (controllable) parameters are part of the state as well, so a Control or a
+ * sampler transfer changing them between two solves outdates all entries. Materials are duplicated per
+ * thread and every thread assembles the same elements for residual and
+ * Jacobian, so no locking is needed here.
+ */
+class TigerSolutionStateCache
+{
+public:
+  TigerSolutionStateCache(FEProblemBase & problem, MaterialData & data,
+                          const std::set<unsigned int> & prop_ids);
+
+  // copies the stored properties of the element if its state is unchanged
+  bool restore(const Elem * elem, const MooseArray<Point> & q_point, Real t, Real dt);
+  // stores the properties just computed for the element of the last restore
+  void store();
+
+  // drops all entries
+  void clear() { _entries.clear(); }
+
+  // adds the current values of a parameter the properties depend on to the state
+  void watch(const std::vector<Real> & values) { _watched.push_back(&values); }
+
+private:
+  struct Entry
+  {
+    // solution state the values were computed from
+    std::vector<Real> _state;
+    // copies of the properties per property id
+    std::vector<std::unique_ptr<PropertyValue>> _values;
+  };
+
+  // fills the solution state of an element
+  void state(const Elem * elem, const MooseArray<Point> & q_point, Real t, Real dt);
+
+  FEProblemBase & _problem;
+  MaterialData & _data;
+  // ids of the properties declared by the material
+  const std::set<unsigned int> & _prop_ids;
+  // parameters whose values are part of the state
+  std::vector<const std::vector<Real> *> _watched;
+  // entries per element id
+  std::unordered_map<dof_id_type, Entry> _entries;
+  // state of the current element and its entry
+  std::vector<Real> _state;
+  std::vector<dof_id_type> _dofs;
+  Entry * _current;
+  unsigned int _n_qp;
+};
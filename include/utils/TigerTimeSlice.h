@@ -0,0 +1,55 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/numeric_vector.h"
+
+class FEProblemBase;
+
+// helpers to move the nonlinear state of a time slice between problems on
+// the same mesh (e.g. parareal propagators on different communicators). A
+// state is a parallel vector in a partition independent layout, each
+// processor only holds its share of it.
+namespace TigerTimeSlice
+{
+/// length of a state: one entry per node or element and variable
+std::size_t size(FEProblemBase & problem);
+
+/// an empty state distributed over the given communicator
+std::unique_ptr<NumericVector<Number>> build(const Parallel::Communicator & comm,
+                                             std::size_t size);
+
+/// writes the local part of the solution of the problem (none if NULL) into
+/// the state; collective on the communicator of the state
+void pack(FEProblemBase * problem, NumericVector<Number> & state);
+
+/// sets current, old and older solution of the problem (none if NULL) from
+/// the state; collective on the communicator of the state
+void unpack(FEProblemBase * problem, const NumericVector<Number> & state);
+
+/// time steps from t0 to t1 with steps of at most dt, false if a solve failed
+bool propagate(FEProblemBase & problem, Real t0, Real t1, Real dt);
+}
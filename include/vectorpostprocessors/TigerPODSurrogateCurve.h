@@ -0,0 +1,47 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "GeneralVectorPostprocessor.h"
+
+class TigerPODSurrogate;
+
+class TigerPODSurrogateCurve : public GeneralVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+  TigerPODSurrogateCurve(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+
+protected:
+  // surrogate userobject
+  const TigerPODSurrogate & _surrogate;
+  // parameters to evaluate the surrogate for (controllable)
+  const std::vector<Real> & _parameters;
+  // time points and values of the curve
+  VectorPostprocessorValue & _time;
+  VectorPostprocessorValue & _value;
+};
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  TIGER - THMC sImulator for GEoscience Research                        */
+/*                                                                        */
+/*  Copyright (C) 2017 by Maziar Gholami Korzani                          */
+/*  Karlsruhe Institute of Technology, Institute of Applied Geosciences   */
+/*  Division of Geothermal Research                                       */
+/*                                                                        */
+/*  This file is part of TIGER App                                        */
+/*                                                                        */
+/*  This program is free software: you can redistribute it and/or modify  */
+/*  it under the terms of the GNU General Public License as published by  */
+/*  the Free Software Foundation, either version 3 of the License, or     */
+/*  (at your option) any later version.                                   */
+/*                                                                        */
+/*  This program is distributed in the hope that it will be useful,       */
+/*  but WITHOUT ANY WARRANTY; without even the implied warranty of        */
+/*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          */
+/*  GNU General Public License for more details.                          */
+/*                                                                        */
+/*  You should have received a copy of the GNU General Public License     */
+/*  along with this program.  If not, see <http://www.gnu.org/licenses/>  */
+/**************************************************************************/
+
+#pragma once
+
+#include "ElementVectorPostprocessor.h"
+
+class PointLocatorBase;
+
+/**
+ * Traces particles along the streamlines of the pore velocity
+ * (darcy_velocity / porosity, averaged per element) from release points to
+ * capture points, e.g. from an injection to a production TigerHydraulicPointSourceH.
+ * Particles move in straight lines through every element and are handed over
+ * to the adjacent element they enter; where a fracture or well element is
+ * reached, the element with the largest velocity is followed. Particles are
+ * distributed over the processors and tracked on the replicated mesh.
+ * The output are the travel times and path lengths of all particles and the
+ * breakthrough curve (cumulative captured fraction over time).
+ */
+class TigerParticleTracker : public ElementVectorPostprocessor
+{
+public:
+  static InputParameters validParams();
+  TigerParticleTracker(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+protected:
+  // traces one particle; returns the capture point or -1
+  int track(const Point & start, Real & time, Real & length) const;
+  // element to continue with at point p, NULL if the particle leaves the domain
+  const Elem * nextElement(const Point & p, const Elem * current) const;
+  // whether p lies in elem (also off the plane of lower dimensional elements)
+  bool inside(const Elem * elem, const Point & p) const;
+  // release positions of all particles
+  std::vector<Point> releasePositions() const;
+
+  // imported props from materials
+  const MaterialProperty<Real> & _n;
+  const MaterialProperty<RealVectorValue> & _dv;
+
+  // release and capture points (and wells providing them)
+  std::vector<Point> _release;
+  std::vector<Point> _capture;
+  // particles per release point, spread over a sphere of this radius
+  const unsigned int _n_particles;
+  const Real _release_radius;
+  // distance to a capture point at which particles are captured
+  const Real _capture_radius;
+  // limits of the tracking
+  const unsigned int _max_steps;
+  const Real _max_time;
+
+  // element averaged pore velocity (local while executing, all after finalize)
+  std::vector<dof_id_type> _ids;
+  std::vector<RealVectorValue> _local_velocity;
+  std::vector<RealVectorValue> _velocity;
+  std::unique_ptr<PointLocatorBase> _locator;
+
+  // output vectors
+  VectorPostprocessorValue & _capture_id;
+  VectorPostprocessorValue & _travel_time;
+  VectorPostprocessorValue & _path_length;
+  VectorPostprocessorValue & _bt_time;
+  VectorPostprocessorValue & _bt_fraction;
+};
@@ -26,6 +26,24 @@
 []
 
 [UserObjects]
+  # hydrostatic pressure with the density of water_uo
+  [./hydrostatic]
+    type = TigerHydrostaticProfile
+    fp_uo = water_uo
+    top = 0
+    bottom = -2800
+    surface_pressure = 0
+    surface_temperature = 473.15
+    temperature_gradient = 0
+  [../]
+  # variable scaling from the material magnitudes instead of hand tuning
+  [./scaling]
+    type = TigerScalingEstimator
+    pressure = pressure
+    temperature = temperature
+    refresh_interval = 10
+    verbose = true
+  [../]
   [./ut_uo]
     type =  TigerPermeabilityConst
     permeability_type = isotropic
@@ -207,10 +225,6 @@
 
 
 [Functions]
-  [./hydrostatic]
-    type = ParsedFunction
-    value = '-1000*9.81*z'
-  [../]
   [./temp]
     type = ParsedFunction
     value = 'if(x<-299.9 & x>-300.1 & y<100.1 & y>99.9 & z<-1899.9 & z>-1900.1, 343.15, 473.15)'
@@ -219,9 +233,10 @@
 
 [ICs]
   [./hydrostatic_ic]
-    type = FunctionIC
+    type = TigerHydrostaticIC
     variable = pressure
-    function = hydrostatic
+    profile = hydrostatic
+    quantity = pressure
   [../]
   [./temp_ic]
     type = FunctionIC
@@ -232,10 +247,8 @@
 
 [Variables]
   [./pressure]
-    scaling = 1e5
   [../]
   [./temperature]
-    scaling = 1e-3
   [../]
 []
 
@@ -321,6 +334,27 @@
       petsc_options_value = 'preonly hypre boomeramg'
     [../]
   [../]
+  # wells and fractures solved directly, the rock matrix by multigrid
+  # (see preconditioning/benchmark.sh)
+  [./p5]
+    type = TigerContrastPreconditioner
+    full = true
+    petsc_options_iname = '-ksp_type -snes_type -snes_linesearch_type'
+    petsc_options_value = 'fgmres newtonls basic'
+  [../]
+[]
+
+[VectorPostprocessors]
+  # travel times and breakthrough between the wells through the final flow field
+  [./tracer]
+    type = TigerParticleTracker
+    injection_wells = pump_in
+    production_wells = pump_out
+    particles = 500
+    release_radius = 5
+    capture_radius = 10
+    execute_on = final
+  [../]
 []
 
 [Executioner]
@@ -342,5 +376,12 @@
 
 [Outputs]
   exodus = true
+  csv = true
   print_linear_residuals = false
+  # binary per-rank restart files; continue an interrupted run with --recover
+  [./checkpoint]
+    type = Checkpoint
+    interval = 10
+    num_files = 2
+  [../]
 []
@@ -0,0 +1,129 @@
+# Extraction from the left end of a column drives the pore pressure below zero.
+# The nonlinear solver is a PETSc variational inequality (vinewtonrsls) with
+# the pressure bounded by BoundsAux, so the solution stays physical instead of
+# being clamped inside the fluid material. TigerFluidRangeViolations reports
+# the quadrature points that still had to be clamped, once per iteration.
+# Swap the solver options for the commented ones to see the clamp counter.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 10
+  nx = 50
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-10'
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0.1
+    specific_density = 2500
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+    min_pressure = 0
+    max_pressure = 5e7
+    out_of_range = clamp
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 7.5e-8
+    kf_uo = rock_uo
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    initial_condition = 1e5
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+[]
+
+[BCs]
+  [./extraction]
+    type = NeumannBC
+    variable = pressure
+    boundary = left
+    value = -0.02
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = pressure
+    boundary = right
+    value = 1e5
+  [../]
+[]
+
+[AuxVariables]
+  [./bounds_dummy]
+  [../]
+[]
+
+[AuxKernels]
+  [./pressure_bounds]
+    type = BoundsAux
+    variable = bounds_dummy
+    bounded_variable = pressure
+    lower = 0
+    upper = 5e7
+  [../]
+[]
+
+[Postprocessors]
+  [./clamped_qps]
+    type = TigerFluidRangeViolations
+    fluid_material = rock_f
+  [../]
+  [./p_min]
+    type = NodalExtremeValue
+    variable = pressure
+    value_type = min
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 20
+  end_time = 2000.0
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-snes_type -pc_type'
+  petsc_options_value = 'vinewtonrsls lu'
+  # petsc_options_iname = '-pc_type'
+  # petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  exodus = true
+  csv = true
+[]
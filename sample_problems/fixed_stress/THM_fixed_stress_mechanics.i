@@ -0,0 +1,135 @@
+# Mechanics part of the fixed-stress split of THM_fixed_stress.i: pressure
+# and temperature are fixed fields given by the master application. The
+# problem is linear, so the Jacobian is computed and factored (LU) once and
+# the factorisation is kept for all following solves (lagged and persisting
+# Jacobian and preconditioner).
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 10
+  nz = 2
+  ymax = 0
+  ymin = -1
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Modules]
+  [./TensorMechanics]
+    [./Master]
+      [./all]
+      add_variables = true
+      strain = SMALL
+      incremental = true
+      temperature = temp
+      eigenstrain_names = 'reduced_eigenstrain'
+      [../]
+    [../]
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+  [../]
+  [./temp]
+    initial_condition = 373.15
+  [../]
+[]
+
+[Kernels]
+  [./poro_x]
+    type = PoroMechanicsCoupling
+    variable = disp_x
+    porepressure = pressure
+    component = 0
+  [../]
+  [./poro_y]
+    type = PoroMechanicsCoupling
+    variable = disp_y
+    porepressure = pressure
+    component = 1
+  [../]
+  [./poro_z]
+    type = PoroMechanicsCoupling
+    variable = disp_z
+    porepressure = pressure
+    component = 2
+  [../]
+[]
+
+[BCs]
+  [./no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = bottom
+    value = 0.0
+  [../]
+  [./no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0.0
+  [../]
+  [./no_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = bottom
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./Elasticity_tensor]
+    type = ComputeElasticityTensor
+    fill_method = symmetric_isotropic_E_nu
+    C_ijkl = '0.5e8 0'
+  [../]
+  [./stress]
+    type = ComputeFiniteStrainElasticStress
+  [../]
+  [./thermal_expansion]
+    type = ComputeThermalExpansionEigenstrain
+    thermal_expansion_coeff = 1e-5
+    temperature = temp
+    stress_free_temperature = 373.15
+    eigenstrain_name = 'thermal_eigenstrain'
+  [../]
+  [./reduced_order_eigenstrain]
+    type = ComputeReducedOrderEigenstrain
+    input_eigenstrain_names = 'thermal_eigenstrain'
+    eigenstrain_name = 'reduced_eigenstrain'
+  [../]
+  [./rock_m]
+    type = TigerMechanicsMaterialM
+    incremental = true
+  [../]
+[]
+
+[Postprocessors]
+  [./nl_its]
+    type = NumNonlinearIterations
+  [../]
+[]
+
+[Preconditioning]
+  [./p1]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  nl_abs_tol = 1e-12
+  line_search = none
+  petsc_options_iname = '-pc_type -snes_lag_jacobian -snes_lag_preconditioner -snes_lag_jacobian_persists -snes_lag_preconditioner_persists'
+  petsc_options_value = 'lu       -2                 -2                      true                        true'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,40 @@
+#!/bin/bash
+# Full Newton against lagged (Picard) fluid properties of TigerBrine on the
+# reservoir model (../3d_reservoir.i). With lagged = true the density and
+# viscosity are taken from the previous time step and their derivatives are
+# dropped; steps whose properties change by more than LAG_TOL are repeated
+# with full Newton. Wall times, the number of nonlinear iterations and the
+# final maxima of temperature and pressure are collected in benchmark.csv.
+#
+#   NP=8 LAG_TOL=0.01 APP=../../tiger-opt ./benchmark.sh
+set -e
+
+APP=${APP:-../../tiger-opt}
+NP=${NP:-4}
+LAG_TOL=${LAG_TOL:-0.01}
+
+cd "$(dirname "$0")"
+echo "lagged,wall_time_s,nl_its,T_max,p_max" > benchmark.csv
+
+for lagged in false true; do
+  base=brine_lagged_$lagged
+  mpiexec -n $NP $APP -i ../3d_reservoir.i \
+    Modules/FluidProperties/brine_uo/type=TigerBrine \
+    Materials/fluid/fp_uo=brine_uo Materials/fluid/pressure=pressure \
+    Materials/fluid/lagged=$lagged Materials/fluid/lag_tolerance=$LAG_TOL \
+    Postprocessors/wall_time/type=PerfGraphData \
+    Postprocessors/wall_time/section_name=Root \
+    Postprocessors/wall_time/data_type=TOTAL \
+    Postprocessors/nl_its/type=NumNonlinearIterations \
+    Postprocessors/nl_its/accumulate_over_step=true \
+    Postprocessors/T_max/type=ElementExtremeValue \
+    Postprocessors/T_max/variable=temperature \
+    Postprocessors/p_max/type=ElementExtremeValue \
+    Postprocessors/p_max/variable=pressure \
+    Outputs/exodus=false Outputs/csv=true Outputs/file_base=$base > $base.log
+  awk -F, -v m=$lagged 'NR == 1 { for (i = 1; i <= NF; ++i) c[$i] = i; next }
+    { w = $c["wall_time"]; n += $c["nl_its"]; t = $c["T_max"]; p = $c["p_max"] }
+    END { printf "%s,%g,%d,%.10g,%.10g\n", m, w, n, t, p }' $base.csv >> benchmark.csv
+done
+
+column -s, -t benchmark.csv
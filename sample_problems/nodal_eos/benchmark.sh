@@ -0,0 +1,35 @@
+#!/bin/bash
+# Fluid properties of TigerBrine evaluated at every quadrature point against
+# once per node and iterate (TigerFluidMaterial evaluation = nodal) on the
+# reservoir model (../3d_reservoir.i). The wall times and the final maxima of
+# temperature and pressure of both runs are collected in benchmark.csv.
+#
+#   NP=8 APP=../../tiger-opt ./benchmark.sh
+set -e
+
+APP=${APP:-../../tiger-opt}
+NP=${NP:-4}
+
+cd "$(dirname "$0")"
+echo "evaluation,wall_time_s,T_max,p_max" > benchmark.csv
+
+for mode in qp nodal; do
+  base=brine_$mode
+  mpiexec -n $NP $APP -i ../3d_reservoir.i \
+    Modules/FluidProperties/brine_uo/type=TigerBrine \
+    Materials/fluid/fp_uo=brine_uo Materials/fluid/pressure=pressure \
+    Materials/fluid/evaluation=$mode \
+    Postprocessors/wall_time/type=PerfGraphData \
+    Postprocessors/wall_time/section_name=Root \
+    Postprocessors/wall_time/data_type=TOTAL \
+    Postprocessors/T_max/type=ElementExtremeValue \
+    Postprocessors/T_max/variable=temperature \
+    Postprocessors/p_max/type=ElementExtremeValue \
+    Postprocessors/p_max/variable=pressure \
+    Outputs/exodus=false Outputs/csv=true Outputs/file_base=$base > $base.log
+  awk -F, -v m=$mode 'NR == 1 { for (i = 1; i <= NF; ++i) c[$i] = i; next }
+    { w = $c["wall_time"]; t = $c["T_max"]; p = $c["p_max"] }
+    END { printf "%s,%g,%.10g,%.10g\n", m, w, t, p }' $base.csv >> benchmark.csv
+done
+
+column -s, -t benchmark.csv
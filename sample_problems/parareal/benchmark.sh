@@ -0,0 +1,43 @@
+#!/bin/bash
+# Wall time of the HDR doublet (../2d_hdr_TH.i, 30 years of monthly steps)
+# solved serially in time against parareal (hdr_parareal.i) with SLICES time
+# slices on the same NP ranks, once with the plain coarse propagator and once
+# with lagged fluid properties in the coarse propagator. Wall times, parareal
+# iterations and the final produced temperature are collected in
+# benchmark.csv.
+#
+#   NP=32 SLICES=16 APP=../../tiger-opt ./benchmark.sh
+set -e
+
+APP=${APP:-../../tiger-opt}
+NP=${NP:-8}
+SLICES=${SLICES:-8}
+
+cd "$(dirname "$0")"
+echo "run,wall_time_s,iterations,T_prod_end" > benchmark.csv
+
+POSITIONS=$(for i in $(seq $SLICES); do printf "0 0 0 "; done)
+T_PROD=(Postprocessors/T_prod/type=PointValue Postprocessors/T_prod/variable=temperature
+  "Postprocessors/T_prod/point=325.0 250.0 0.0")
+
+start=$(date +%s.%N)
+mpiexec -n $NP $APP -i ../2d_hdr_TH.i "${T_PROD[@]}" \
+  Outputs/exodus=false Outputs/csv=true Outputs/file_base=serial > serial.log
+wall=$(echo "$(date +%s.%N) - $start" | bc)
+awk -F, -v w=$wall 'NR == 1 { for (i = 1; i <= NF; ++i) k[$i] = i; next }
+  { t = $k["T_prod"] } END { printf "serial,%g,,%.6f\n", w, t }' serial.csv >> benchmark.csv
+
+for coarse in plain lagged; do
+  base=parareal_$coarse
+  lagged=false
+  [ $coarse = lagged ] && lagged=true
+  start=$(date +%s.%N)
+  mpiexec -n $NP $APP -i hdr_parareal.i MultiApps/fine/positions="$POSITIONS" \
+    Materials/fluid/lagged=$lagged Outputs/exodus=false Outputs/file_base=$base > $base.log
+  wall=$(echo "$(date +%s.%N) - $start" | bc)
+  its=$(grep -c "^Parareal iteration" $base.log || true)
+  awk -F, -v w=$wall -v r=$base -v n=$its 'NR == 1 { for (i = 1; i <= NF; ++i) k[$i] = i; next }
+    { t = $k["T_prod"] } END { printf "%s,%g,%d,%.6f\n", r, w, n, t }' $base.csv >> benchmark.csv
+done
+
+column -s, -t benchmark.csv
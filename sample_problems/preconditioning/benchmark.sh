@@ -0,0 +1,31 @@
+#!/bin/bash
+# Linear iterations of the reservoir model (../3d_reservoir.i) against the
+# permeability of the wells, once with algebraic multigrid on the whole system
+# (p1) and once with TigerContrastPreconditioner (p5). The total number of
+# linear iterations of every run is collected in benchmark.csv.
+#
+#   NP=8 APP=../../tiger-opt ./benchmark.sh
+set -e
+
+APP=${APP:-../../tiger-opt}
+NP=${NP:-4}
+K_WELL=${K_WELL:-"1e-11 1e-9 1e-7 1e-5"}
+PRECS=${PRECS:-"p1 p5"}
+
+cd "$(dirname "$0")"
+echo "preconditioner,k_well,linear_iterations" > benchmark.csv
+
+for p in $PRECS; do
+  for k in $K_WELL; do
+    base=contrast_${p}_${k}
+    mpiexec -n $NP $APP -i ../3d_reservoir.i \
+      Preconditioning/active=$p UserObjects/w_uo/k0=$k \
+      Postprocessors/lin/type=NumLinearIterations \
+      Outputs/exodus=false Outputs/csv=true Outputs/file_base=$base > $base.log
+    awk -F, -v p=$p -v k=$k 'NR == 1 { for (i = 1; i <= NF; ++i) c[$i] = i; next }
+      { s += $c["lin"] }
+      END { printf "%s,%s,%d\n", p, k, s }' $base.csv >> benchmark.csv
+  done
+done
+
+column -s, -t benchmark.csv
@@ -0,0 +1,54 @@
+#!/bin/bash
+# Nonlinear iterations per time step of the HDR doublet (../2d_hdr_TH.i) and
+# the THM test (../../test/THM/3d_THM_T_P.i) with
+#   base       Newton started from the previous time step
+#   predictor  initial guess from TigerQuadraticPredictor
+#   sequencing the first COARSE_STEPS steps on the coarse mesh, then refined
+#              once by TigerSequencingMarker to the production mesh
+#   both       predictor and sequencing
+# The production mesh of the HDR model is ex_hdr.msh refined once; the THM
+# test is coarsened to 1x5x1 elements so its production mesh stays 2x10x2.
+# Results are collected in benchmark.csv.
+#
+#   NP=8 COARSE_STEPS=3 APP=../../tiger-opt ./benchmark.sh
+set -e
+
+APP=${APP:-../../tiger-opt}
+NP=${NP:-4}
+COARSE_STEPS=${COARSE_STEPS:-3}
+
+cd "$(dirname "$0")"
+echo "model,mode,steps,nl_its,nl_its_per_step,wall_time_s" > benchmark.csv
+
+PREDICTOR="Executioner/Predictor/type=TigerQuadraticPredictor Executioner/Predictor/scale=1"
+SEQUENCING="Adaptivity/marker=seq Adaptivity/Markers/seq/type=TigerSequencingMarker
+  Adaptivity/Markers/seq/refinements=1 Adaptivity/Markers/seq/coarse_steps=$COARSE_STEPS"
+
+run() {
+  model=$1; mode=$2; input=$3; shift 3
+  base=${model}_$mode
+  mpiexec -n $NP $APP -i $input "$@" \
+    Postprocessors/nl_its/type=NumNonlinearIterations \
+    Postprocessors/wall_time/type=PerfGraphData \
+    Postprocessors/wall_time/section_name=Root \
+    Postprocessors/wall_time/data_type=TOTAL \
+    Outputs/exodus=false Outputs/csv=true Outputs/file_base=$base > $base.log
+  awk -F, -v m=$model -v c=$mode 'NR == 1 { for (i = 1; i <= NF; ++i) k[$i] = i; next }
+    $k["time"] > 0 { n++; s += $k["nl_its"]; w = $k["wall_time"] }
+    END { printf "%s,%s,%d,%d,%.2f,%g\n", m, c, n, s, s / n, w }' $base.csv >> benchmark.csv
+}
+
+HDR=../2d_hdr_TH.i
+run hdr base $HDR Mesh/uniform_refine=1
+run hdr predictor $HDR Mesh/uniform_refine=1 $PREDICTOR
+run hdr sequencing $HDR $SEQUENCING
+run hdr both $HDR $PREDICTOR $SEQUENCING
+
+THM=../../test/THM/3d_THM_T_P.i
+COARSE="Mesh/nx=1 Mesh/ny=5 Mesh/nz=1"
+run thm base $THM
+run thm predictor $THM $PREDICTOR
+run thm sequencing $THM $COARSE $SEQUENCING
+run thm both $THM $COARSE $PREDICTOR $SEQUENCING
+
+column -s, -t benchmark.csv
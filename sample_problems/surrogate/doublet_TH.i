@@ -0,0 +1,164 @@
+# Full-order thermo-hydraulic doublet producing the training curves of
+# doublet_TH_surrogate.i, e.g. for an injection rate of 20 kg/s at 70 C:
+#   tiger-opt -i doublet_TH.i DiracKernels/pump_in/mass_flux=-20 \
+#     DiracKernels/pump_out/mass_flux=20 BCs/inject_t/value=343.15 \
+#     Outputs/file_base=run_20_70
+[Mesh]
+  [./gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmax = 2000
+    ymax = 1000
+    nx = 80
+    ny = 40
+  [../]
+  [./inject]
+    type = ExtraNodesetGenerator
+    input = gen
+    new_boundary = inject
+    coord = '500 500 0'
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-12'
+  [../]
+  [./supg]
+    type = TigerSUPG
+    effective_length = directional_average
+    supg_coeficient = transient_tezduyar
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+    scale_factor = 50
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0.1
+    specific_density = 2600
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 1.0e-10
+    kf_uo = rock_uo
+  [../]
+  [./rock_t]
+    type = TigerThermalMaterialT
+    conductivity_type = isotropic
+    lambda = 2.5
+    specific_heat = 950
+    has_supg = true
+    supg_uo = supg
+  [../]
+[]
+
+[BCs]
+  [./boundary_p]
+    type = DirichletBC
+    variable = pressure
+    boundary = 'left right top bottom'
+    value = 2e7
+  [../]
+  [./inject_t]
+    type = DirichletBC
+    variable = temperature
+    boundary = inject
+    value = 343.15
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    initial_condition = 2e7
+  [../]
+  [./temperature]
+    initial_condition = 423.15
+  [../]
+[]
+
+[DiracKernels]
+  [./pump_in]
+    type = TigerHydraulicPointSourceH
+    point = '500 500 0'
+    mass_flux = -20
+    variable = pressure
+  [../]
+  [./pump_out]
+    type = TigerHydraulicPointSourceH
+    point = '1500 500 0'
+    mass_flux = 20
+    variable = pressure
+  [../]
+[]
+
+[Kernels]
+  [./H_diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./H_dt]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+  [./T_diff]
+    type = TigerThermalDiffusionKernelT
+    variable = temperature
+  [../]
+  [./T_advect]
+    type = TigerThermalAdvectionKernelT
+    variable = temperature
+    pressure = pressure
+  [../]
+  [./T_dt]
+    type = TigerThermalTimeKernelT
+    variable = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./T_production]
+    type = PointValue
+    variable = temperature
+    point = '1500 500 0'
+  [../]
+  # wall time of the run for the speed-up benchmark of the surrogate
+  [./run_time]
+    type = PerfGraphData
+    section_name = Root
+    data_type = TOTAL
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  # the fixed time steps give the same curve points for all the runs
+  dt = 3.15576e7
+  end_time = 9.46728e8
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+  print_linear_residuals = false
+[]
@@ -0,0 +1,43 @@
+# Reduced-order surrogate of the production temperature of doublet_TH.i
+# trained from full runs over injection rate (kg/s) and injection
+# temperature (C). The console reports the retained POD modes, the
+# leave-one-out error, the error against the validation run and the time
+# of one surrogate evaluation compared to a full run.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[UserObjects]
+  [./pod]
+    type = TigerPODSurrogate
+    training_files = 'run_10_40.csv run_10_70.csv run_20_40.csv run_20_70.csv
+                      run_30_40.csv run_30_70.csv run_40_40.csv run_40_70.csv'
+    training_parameters = '10 40; 10 70; 20 40; 20 70; 30 40; 30 70; 40 40; 40 70'
+    validation_files = 'run_25_55.csv'
+    validation_parameters = '25 55'
+    curve = T_production
+    runtime_column = run_time
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./production_temperature]
+    type = TigerPODSurrogateCurve
+    surrogate = pod
+    parameters = '35 60'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,145 @@
+# Single realisation of the hydraulic doublet; k0 and the circulation rate are
+# set by doublet_H_sweep.i through the controllable parameters. Both wells
+# follow the sampled rate, so every realisation is a balanced doublet
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 500
+  ymax = 500
+  nx = 50
+  ny = 50
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+      density = 1000
+      viscosity = 0.001
+      bulk_modulus = 1e+10
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./matrix_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-14'
+  [../]
+[]
+
+[Materials]
+  [./matrix_g]
+    type = TigerGeometryMaterial
+    scale_factor = 200
+  [../]
+  [./matrix_p]
+    type = TigerPorosityMaterial
+    porosity = 0.1
+    specific_density = 2600
+  [../]
+  [./matrix_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./matrix_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    kf_uo = matrix_uo
+    compressibility = 1.0e-10
+  [../]
+[]
+
+[BCs]
+  [./boundary_h]
+    type = DirichletBC
+    variable = pressure
+    boundary = 'left right top bottom'
+    value = 1e7
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    initial_condition = 1e7
+  [../]
+[]
+
+[Functions]
+  # circulation rate (kg/s), set by the master application
+  [./rate]
+    type = ConstantFunction
+    value = 1.0
+  [../]
+  [./injection]
+    type = ParsedFunction
+    vars = 'q'
+    vals = 'rate_value'
+    value = '-q'
+  [../]
+[]
+
+[DiracKernels]
+  [./pump_in]
+    type = TigerHydraulicPointSourceH
+    point = '175.0 250.0 0.0'
+    mass_flux_function = injection
+    variable = pressure
+  [../]
+  [./pump_out]
+    type = TigerHydraulicPointSourceH
+    point = '325.0 250.0 0.0'
+    mass_flux_function = rate
+    variable = pressure
+  [../]
+[]
+
+[Kernels]
+  [./H_diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./H_time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+[]
+
+[Postprocessors]
+  [./rate_value]
+    type = FunctionValuePostprocessor
+    function = rate
+    execute_on = 'initial timestep_begin'
+  [../]
+  [./p_inject]
+    type = PointValue
+    variable = pressure
+    point = '175.0 250.0 0.0'
+  [../]
+  [./p_produce]
+    type = PointValue
+    variable = pressure
+    point = '325.0 250.0 0.0'
+  [../]
+[]
+
+[Controls]
+  # receives the sampled parameters from the master application
+  [./stochastic]
+    type = SamplerReceiver
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 86400
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  console = false
+[]
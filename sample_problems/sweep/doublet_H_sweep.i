@@ -0,0 +1,74 @@
+# Permeability / circulation rate sweep over the hydraulic doublet of
+# doublet_H_sub.i. The mesh and the setup of the sub-application are built
+# once per processor group (batch-restore) and only the controllable
+# parameters change between the samples; the groups run concurrently on
+# sub-communicators of min_procs_per_app processors. The injection pressures
+# of all samples end up in one table (doublet_H_sweep_out_results_*.csv) next
+# to the sampled parameters (doublet_H_sweep_out_samples_*.csv).
+# Run e.g. with: mpiexec -n 8 tiger-opt -i doublet_H_sweep.i
+[StochasticTools]
+[]
+
+[Distributions]
+  [./permeability]
+    type = Uniform
+    lower_bound = 1.0e-15
+    upper_bound = 1.0e-13
+  [../]
+  [./rate]
+    type = Uniform
+    lower_bound = 0.5
+    upper_bound = 5.0
+  [../]
+[]
+
+[Samplers]
+  [./sample]
+    type = MonteCarlo
+    num_rows = 200
+    distributions = 'permeability rate'
+    execute_on = PRE_MULTIAPP_SETUP
+  [../]
+[]
+
+[MultiApps]
+  [./runner]
+    type = SamplerFullSolveMultiApp
+    input_files = 'doublet_H_sub.i'
+    sampler = sample
+    mode = batch-restore
+    min_procs_per_app = 2
+  [../]
+[]
+
+[Transfers]
+  [./parameters]
+    type = SamplerParameterTransfer
+    multi_app = runner
+    sampler = sample
+    parameters = 'UserObjects/matrix_uo/k0 Functions/rate/value'
+    to_control = 'stochastic'
+  [../]
+  [./results]
+    type = SamplerPostprocessorTransfer
+    multi_app = runner
+    sampler = sample
+    to_vector_postprocessor = results
+    from_postprocessor = 'p_inject'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./results]
+    type = StochasticResults
+  [../]
+  [./samples]
+    type = SamplerData
+    sampler = sample
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'FINAL'
+[]
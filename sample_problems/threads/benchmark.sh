@@ -0,0 +1,37 @@
+#!/bin/bash
+# MPI-only against hybrid MPI+threads assembly on the THS reservoir model
+# (../3d_reservoir.i) using the same number of cores. The replicated mesh is
+# stored once per rank, so fewer ranks with more threads each need less
+# memory. The total memory of all ranks and the wall time of every run are
+# collected in benchmark.csv.
+#
+#   CORES=128 APP=../../tiger-opt ./benchmark.sh
+set -e
+
+APP=${APP:-../../tiger-opt}
+CORES=${CORES:-8}
+THREADS=${THREADS:-"1 2 4 8"}
+
+cd "$(dirname "$0")"
+echo "ranks,threads,memory_mb,wall_time_s" > benchmark.csv
+
+for t in $THREADS; do
+  n=$((CORES / t))
+  [ $n -ge 1 ] || continue
+  base=reservoir_${n}x${t}
+  mpiexec -n $n $APP -i ../3d_reservoir.i --n-threads=$t \
+    Postprocessors/memory/type=MemoryUsage \
+    Postprocessors/memory/value_type=total \
+    Postprocessors/memory/mem_units=megabytes \
+    Postprocessors/memory/execute_on='initial timestep_end' \
+    Postprocessors/wall_time/type=PerfGraphData \
+    Postprocessors/wall_time/section_name=Root \
+    Postprocessors/wall_time/data_type=TOTAL \
+    Outputs/exodus=false Outputs/csv=true Outputs/file_base=$base > $base.log
+  # peak memory over the run and the final wall time
+  awk -F, -v n=$n -v t=$t 'NR == 1 { for (i = 1; i <= NF; ++i) c[$i] = i; next }
+    { if ($c["memory"] > m) m = $c["memory"]; w = $c["wall_time"] }
+    END { printf "%d,%d,%g,%g\n", n, t, m, w }' $base.csv >> benchmark.csv
+done
+
+column -s, -t benchmark.csv
@@ -0,0 +1,144 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 10
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-10'
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0
+    specific_density = 2500
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 7.5e-8
+    kf_uo = rock_uo
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = NeumannBC
+    variable = pressure
+    boundary = left
+    value = -0.02
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = pressure
+    boundary = right
+    value = 0.0
+  [../]
+[]
+
+[Functions]
+  [./analytical_function]
+    type = ParsedFunction
+    value = '2e5*x-2e6'
+  [../]
+[]
+
+[AuxVariables]
+  [./vx]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./analytical_solution]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+[]
+
+[AuxKernels]
+  [./vx_ker]
+    type = TigerDarcyVelocityH
+    pressure = pressure
+    variable =  vx
+    component = x
+  [../]
+  [./a_ker]
+    type = FunctionAux
+    function = analytical_function
+    variable = analytical_solution
+    execute_on = initial
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+[]
+
+[Executioner]
+  type = TigerPseudoTransient
+  steady_residual_rel_tol = 1e-10
+  end_time = 1e30
+  num_steps = 100
+  l_tol = 1e-10
+  nl_rel_tol = 1e-12
+  solve_type = 'PJFNK'
+  jacobian_lag = 5
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  [./TimeStepper]
+    type = TigerSERTimeStepper
+    dt = 1
+    growth_factor = 10
+  [../]
+[]
+
+[Postprocessors]
+  [./error]
+    type = NodalL2Error
+    variable = pressure
+    function = analytical_function
+  [../]
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  # the pseudo time of the steady state depends on the step sequence, only
+  # the error of the final state is checked
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
@@ -0,0 +1,86 @@
+# fluid properties of TigerIdealWater on the fields p = x and T = 300 + 100 x:
+# with reference density 1, reference pressure 0, bulk modulus 1 and no
+# thermal expansion the density is exp(x). In nodal mode density and Vogel
+# viscosity are linear on each element, so the integrals are the trapezoidal
+# sums of the nodal values (1.7197134914 and 4.223671035e-4); the qp mode
+# gives 1.7182817887 and 4.209593685e-4
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmax = 1
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerIdealWater
+      reference_density = 1
+      reference_pressure = 0
+      bulk_modulus = 1
+      thermal_expansion = 0
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./rock_f]
+    type = TigerFluidMaterial
+    pressure = pressure
+    temperature = temperature
+    fp_uo = water_uo
+    evaluation = nodal
+  [../]
+[]
+
+[Functions]
+  [./pressure]
+    type = ParsedFunction
+    value = 'x'
+  [../]
+  [./temperature]
+    type = ParsedFunction
+    value = '300+100*x'
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    [./InitialCondition]
+      type = FunctionIC
+      function = pressure
+    [../]
+  [../]
+  [./temperature]
+    [./InitialCondition]
+      type = FunctionIC
+      function = temperature
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./density]
+    type = ElementIntegralMaterialProperty
+    mat_prop = fluid_density
+  [../]
+  [./viscosity]
+    type = ElementIntegralMaterialProperty
+    mat_prop = fluid_viscosity
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,160 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 10
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-10'
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0
+    specific_density = 2500
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 7.5e-8
+    kf_uo = rock_uo
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = NeumannBC
+    variable = pressure
+    boundary = left
+    value = -0.02
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = pressure
+    boundary = right
+    value = 0.0
+  [../]
+[]
+
+[Functions]
+  [./analytical_function]
+    type = ParsedFunction
+    value = '2e5*x-2e6'
+  [../]
+[]
+
+[AuxVariables]
+  [./vx]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./analytical_solution]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+[]
+
+[AuxKernels]
+  [./vx_ker]
+    type = TigerDarcyVelocityH
+    pressure = pressure
+    variable =  vx
+    component = x
+  [../]
+  [./a_ker]
+    type = FunctionAux
+    function = analytical_function
+    variable = analytical_solution
+    execute_on = initial
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+[]
+
+[MultiApps]
+  [./fine]
+    type = TigerPararealMultiApp
+    input_files = 1d_flux.i
+    positions = '0 0 0  0 0 0  0 0 0  0 0 0'
+    cli_args = 'Outputs/exodus=false'
+  [../]
+[]
+
+[Executioner]
+  type = TigerParareal
+  fine_app = fine
+  end_time = 1000.0
+  coarse_dt = 100.0
+  fine_dt = 20.0
+  tolerance = 1e-8
+  l_tol = 1e-10
+  nl_rel_step_tol = 1e-14
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Postprocessors]
+  [./error]
+    type = NodalL2Error
+    variable = pressure
+    function = analytical_function
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_linear_residuals = false
+  # error of the last slice, compared with the serial run of 1d_flux.i
+  [./final]
+    type = CSV
+    execute_on = final
+    file_base = parareal_final
+  [../]
+  # error of the first slice state (t = 250), which is the fine solution from
+  # the first iteration on while the coarse one differs by an order of
+  # magnitude: 6576.08 against 77925.8 (linear FE system, implicit Euler
+  # with steps of 12 x 20 + 10 against 100 + 100 + 50)
+  [./slice]
+    type = CSV
+    start_time = 250
+    end_time = 250
+    file_base = parareal_slice
+  [../]
+[]
@@ -0,0 +1,96 @@
+# particles released on a circle of radius 0.15 around (1, 0.5) in a uniform
+# pore velocity of 1e-10 / 1e-3 * 1e5 / 0.25 = 0.04 m/s along x and captured
+# within 0.2 of (9, 0.5): the travel times are (9 - x0) / 0.04
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 10
+  nx = 20
+  ny = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-10'
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0.25
+    specific_density = 2500
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 1e-9
+    kf_uo = rock_uo
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = pressure
+    boundary = left
+    value = 1e6
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = pressure
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./tracer]
+    type = TigerParticleTracker
+    release_points = '1 0.5 0'
+    capture_points = '9 0.5 0'
+    particles = 4
+    release_radius = 0.15
+    capture_radius = 0.2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,58 @@
+# every quadrature point is below min_pressure, so the fluid material is
+# clamped once per quadrature point when the density integral evaluates it:
+# 10 elements with 2 Gauss points each give 20 clamped points
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmax = 10
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./rock_f]
+    type = TigerFluidMaterial
+    pressure = pressure
+    fp_uo = water_uo
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    initial_condition = -1e5
+  [../]
+[]
+
+[Postprocessors]
+  [./density]
+    type = ElementIntegralMaterialProperty
+    mat_prop = fluid_density
+  [../]
+  [./clamped]
+    type = TigerFluidRangeViolations
+    fluid_material = rock_f
+    execute_on = timestep_end
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
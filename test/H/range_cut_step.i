@@ -0,0 +1,112 @@
+# the left boundary pressure drops below min_pressure only for 95 < t < 105.
+# The step to t = 100 throws in the fluid material and is cut to t = 95; the
+# next step (dt grows back to 10) jumps to t = 105, after the drop, so the run
+# recovers and reaches end_time with the pressure unchanged.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmax = 10
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-10'
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0
+    specific_density = 2500
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    pressure = pressure
+    fp_uo = water_uo
+    out_of_range = cut_step
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 7.5e-8
+    kf_uo = rock_uo
+  [../]
+[]
+
+[Functions]
+  [./drop]
+    type = ParsedFunction
+    value = 'if(t>95&t<105,-1e7,1e5)'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = FunctionDirichletBC
+    variable = pressure
+    boundary = left
+    function = drop
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = pressure
+    boundary = right
+    value = 1e5
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    initial_condition = 1e5
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+[]
+
+[Postprocessors]
+  [./p_mid]
+    type = PointValue
+    variable = pressure
+    point = '5 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 120
+  solve_type = NEWTON
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 10
+    growth_factor = 2
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_linear_residuals = false
+[]
@@ -0,0 +1,159 @@
+# Jacobian check of the coupled pressure / displacement blocks (run with
+# -snes_test_jacobian by the PetscJacobianTester). Random states, an evolving
+# porosity coupled to pressure and strain, a Kozeny-Carman permeability and a
+# compressible fluid make every derivative of TigerHydroMechanicsKernelHM and
+# TigerHydraulicTimeKernelH non-zero. The material values are chosen so that
+# the hydraulic and mechanical blocks have similar magnitudes.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Modules]
+  [./TensorMechanics]
+    [./Master]
+      [./all]
+      add_variables = true
+      strain = SMALL
+      incremental = true
+      [../]
+    [../]
+  [../]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerIdealWater
+      bulk_modulus = 10
+      reference_pressure = 0
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type = TigerPermeabilityVar
+    permeability_type = isotropic
+    k0 = '1.0e-3'
+    n0 = 0.2
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+[]
+
+[ICs]
+  [./pressure]
+    type = RandomIC
+    variable = pressure
+    min = 0.05
+    max = 0.2
+  [../]
+  [./disp_x]
+    type = RandomIC
+    variable = disp_x
+    min = -1e-2
+    max = 1e-2
+  [../]
+  [./disp_y]
+    type = RandomIC
+    variable = disp_y
+    min = -1e-2
+    max = 1e-2
+  [../]
+  [./disp_z]
+    type = RandomIC
+    variable = disp_z
+    min = -1e-2
+    max = 1e-2
+  [../]
+[]
+
+[Kernels]
+  [./hm]
+    type = TigerHydroMechanicsKernelHM
+    variable = pressure
+  [../]
+  [./hm_time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+  [./poro_x]
+    type = PoroMechanicsCoupling
+    variable = disp_x
+    porepressure = pressure
+    component = 0
+  [../]
+  [./poro_y]
+    type = PoroMechanicsCoupling
+    variable = disp_y
+    porepressure = pressure
+    component = 1
+  [../]
+  [./poro_z]
+    type = PoroMechanicsCoupling
+    variable = disp_z
+    porepressure = pressure
+    component = 2
+  [../]
+[]
+
+[Materials]
+  [./Elasticity_tensor]
+    type = ComputeElasticityTensor
+    fill_method = symmetric_isotropic_E_nu
+    C_ijkl = '1 0.25'
+  [../]
+  [./stress]
+    type = ComputeFiniteStrainElasticStress
+  [../]
+  [./rock_g]
+    type = TigerGeometryMaterial
+    gravity = '0 0 -1e-3'
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    pressure = pressure
+    porosity = 0.2
+    specific_density = 2500
+    porosity_evolution = true
+  [../]
+  [./rock_m]
+    type = TigerMechanicsMaterialM
+    incremental = true
+    biot_coefficient = 0.6
+    solid_bulk_modulus = 1
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    pressure = pressure
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 0.1
+    kf_uo = rock_uo
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 2
+  dt = 1
+[]
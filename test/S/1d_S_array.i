@@ -0,0 +1,145 @@
+# two species transported with the array kernels next to the scalar solute
+# kernels; the second species has twice the diffusion and a retardation of 2,
+# so both species have to reproduce the scalar solution
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 1
+    specific_density = 2500
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_s]
+    type = TigerSoluteMaterialS
+    diffusion = 1e-6
+    advection_type = pure_diffusion
+    multi_species = true
+  [../]
+[]
+
+[BCs]
+  [./front]
+    type =  DirichletBC
+    variable = solute
+    boundary = left
+    value = 0
+  [../]
+  [./back]
+    type =  DirichletBC
+    variable = solute
+    boundary = right
+    value = 100.0
+  [../]
+  [./species_front]
+    type =  ArrayDirichletBC
+    variable = species
+    boundary = left
+    values = '0 0'
+  [../]
+  [./species_back]
+    type =  ArrayDirichletBC
+    variable = species
+    boundary = right
+    values = '100.0 100.0'
+  [../]
+[]
+
+[Variables]
+  [./solute]
+    initial_condition = 0
+  [../]
+  [./species]
+    components = 2
+    initial_condition = '0 0'
+  [../]
+[]
+
+[AuxVariables]
+  [./species_0]
+  [../]
+  [./species_1]
+  [../]
+[]
+
+[AuxKernels]
+  [./species_0]
+    type = ArrayVariableComponent
+    variable = species_0
+    array_variable = species
+    component = 0
+  [../]
+  [./species_1]
+    type = ArrayVariableComponent
+    variable = species_1
+    array_variable = species
+    component = 1
+  [../]
+[]
+
+[Kernels]
+  [./S_dt]
+    type = TigerSoluteTimeKernelS
+    variable = solute
+  [../]
+  [./S_diff]
+    type = TigerSoluteDiffusionKernelS
+    variable = solute
+  [../]
+  [./species_dt]
+    type = TigerSoluteArrayTimeKernelS
+    variable = species
+    retardation = '1 2'
+  [../]
+  [./species_diff]
+    type = TigerSoluteArrayDiffusionKernelS
+    variable = species
+    diffusion = '1e-6 2e-6'
+  [../]
+[]
+
+[Postprocessors]
+  [./error_0]
+    type = ElementL2Difference
+    variable = species_0
+    other_variable = solute
+  [../]
+  [./error_1]
+    type = ElementL2Difference
+    variable = species_1
+    other_variable = solute
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 2.0e4
+  l_tol = 1e-10 #difference between first and last linear step
+  nl_rel_step_tol = 1e-14 #machine percision
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
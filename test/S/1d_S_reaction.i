@@ -0,0 +1,85 @@
+# uniform concentration decaying and sorbing by the operator-split reaction
+# step; with porosity 0.25, bulk density 1500 and Kd = 1e-4 only the dissolved
+# fraction 0.625 decays, i.e. c = 100 exp(-0.625 * decay * t)
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0.25
+    specific_density = 2000
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_s]
+    type = TigerSoluteMaterialS
+    diffusion = 1e-9
+    advection_type = pure_diffusion
+  [../]
+[]
+
+[Variables]
+  [./solute]
+    initial_condition = 100
+  [../]
+[]
+
+[Kernels]
+  [./S_dt]
+    type = TigerSoluteTimeKernelS
+    variable = solute
+  [../]
+  [./S_diff]
+    type = TigerSoluteDiffusionKernelS
+    variable = solute
+  [../]
+[]
+
+[UserObjects]
+  [./reaction]
+    type = TigerSoluteReactionS
+    concentration = solute
+    decay = 1e-5
+    distribution_coefficient = 1e-4
+    sorbed_phase_decays = false
+  [../]
+[]
+
+[Postprocessors]
+  [./concentration]
+    type = NodalVariableValue
+    variable = solute
+    nodeid = 5
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 10
+  dt = 1e4
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
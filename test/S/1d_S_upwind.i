@@ -0,0 +1,113 @@
+# cell-centred finite volume solute transport: upwind advection with
+# v = 1, two-point diffusion with D = 0.05 and an inflow concentration of 1 on
+# ten elements; the gold values are the solution of the same implicit upwind
+# scheme written out by hand and stay within [0, 1]
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./vel]
+    type = ParsedVectorFunction
+    value_x = 1
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 1
+    specific_density = 2000
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_s]
+    type = TigerSoluteMaterialS
+    diffusion = 0.05
+    advection_type = user_velocity
+    user_velocity = vel
+  [../]
+[]
+
+[Variables]
+  [./solute]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./S_dt]
+    type = TigerSoluteTimeKernelS
+    variable = solute
+  [../]
+[]
+
+[DGKernels]
+  [./S_advect]
+    type = TigerSoluteUpwindDGKernelS
+    variable = solute
+  [../]
+  [./S_diff]
+    type = TigerSoluteTPFADGKernelS
+    variable = solute
+  [../]
+[]
+
+[BCs]
+  [./inflow]
+    type = TigerSoluteUpwindInflowS
+    variable = solute
+    boundary = 'left right'
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./c_0]
+    type = ElementalVariableValue
+    variable = solute
+    elementid = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./c_2]
+    type = ElementalVariableValue
+    variable = solute
+    elementid = 2
+    execute_on = 'initial timestep_end'
+  [../]
+  [./c_5]
+    type = ElementalVariableValue
+    variable = solute
+    elementid = 5
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.05
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,121 @@
+# cell-centred finite volume heat transport: upwind advection with v = 1,
+# two-point conduction and an inflow temperature of 1 on ten elements. With
+# porosity 1 the heat capacity is rho_f cp_f = 4e6 and the conductivity is
+# that of the fluid, 2e5 = 0.05 rho_f cp_f, so the temperature follows the
+# same scheme as the solute of test/S/1d_S_upwind.i (D = 0.05) and the gold
+# values are the hand computed ones of that test; any flux not weighted by
+# rho_f cp_f changes them
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+      density = 1000
+      cp = 4000
+      thermal_conductivity = 2e5
+    [../]
+  [../]
+[]
+
+[Functions]
+  [./vel]
+    type = ParsedVectorFunction
+    value_x = 1
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 1
+    specific_density = 2000
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_t]
+    type = TigerThermalMaterialT
+    conductivity_type = isotropic
+    lambda = 2
+    specific_heat = 840
+    advection_type = user_velocity
+    user_velocity = vel
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./T_dt]
+    type = TigerThermalTimeKernelT
+    variable = temperature
+  [../]
+[]
+
+[DGKernels]
+  [./T_advect]
+    type = TigerThermalUpwindDGKernelT
+    variable = temperature
+  [../]
+  [./T_diff]
+    type = TigerThermalTPFADGKernelT
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./inflow]
+    type = TigerThermalUpwindInflowT
+    variable = temperature
+    boundary = 'left right'
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./T_0]
+    type = ElementalVariableValue
+    variable = temperature
+    elementid = 0
+    execute_on = 'initial timestep_end'
+  [../]
+  [./T_2]
+    type = ElementalVariableValue
+    variable = temperature
+    elementid = 2
+    execute_on = 'initial timestep_end'
+  [../]
+  [./T_5]
+    type = ElementalVariableValue
+    variable = temperature
+    elementid = 5
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.05
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+[]
+
+[Outputs]
+  csv = true
+[]
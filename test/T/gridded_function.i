@@ -0,0 +1,69 @@
+# trilinear interpolation of a 3x2x2 grid holding 10^(i + 2j + 3k), i.e. the
+# product 10^i * 100^j * 1000^k, so the linear value is the product of the 1D
+# interpolations and the logarithmic value is 10^(x + y + 3z/4)
+#   (1.25, 0.5, 3): 32.5 * 25.75 * 750.25 = 627865.46875, 10^4
+#   (5, -1, 2) is clamped to (2, 0, 2): 100 * 1 * 500.5 = 50050, 10^3.5
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./linear]
+    type = TigerGriddedFunction
+    file = gridded.grid
+  [../]
+  [./logarithmic]
+    type = TigerGriddedFunction
+    file = gridded.grid
+    interpolation = logarithmic
+  [../]
+[]
+
+[Postprocessors]
+  [./linear_inside]
+    type = FunctionValuePostprocessor
+    function = linear
+    point = '1.25 0.5 3'
+    execute_on = initial
+  [../]
+  [./linear_clamped]
+    type = FunctionValuePostprocessor
+    function = linear
+    point = '5 -1 2'
+    execute_on = initial
+  [../]
+  [./log_inside]
+    type = FunctionValuePostprocessor
+    function = logarithmic
+    point = '1.25 0.5 3'
+    execute_on = initial
+  [../]
+  [./log_clamped]
+    type = FunctionValuePostprocessor
+    function = logarithmic
+    point = '5 -1 2'
+    execute_on = initial
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = initial
+  [../]
+[]
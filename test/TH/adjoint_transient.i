@@ -0,0 +1,179 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmin = 0
+  xmax = 1
+  nx = 10
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+      density = 1
+      cp = 1
+      thermal_conductivity = 0.01
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./matrix_uo1]
+    type =  TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-8'
+  [../]
+  [./supg]
+    type = TigerSUPG
+    effective_length = min
+    supg_coeficient = optimal
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 1
+    specific_density = 1
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./matrix_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    kf_uo = matrix_uo1
+    compressibility = 1.0e-10
+  [../]
+  [./matrix_t]
+    type = TigerThermalMaterialT
+    conductivity_type = isotropic
+    mean_calculation_type = arithmetic
+    lambda = 0.01
+    specific_heat = 1
+    has_supg = false
+  [../]
+[]
+
+[BCs]
+  [./left_h]
+    type = DirichletBC
+    variable = pressure
+    boundary = left
+    value = 1e5
+  [../]
+  [./right_h]
+    type = DirichletBC
+    variable = pressure
+    boundary = right
+    value = 0
+  [../]
+  [./left_t]
+    type = DirichletBC
+    variable = temperature
+    boundary = left
+    value = 0
+  [../]
+  [./right_t]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[AuxVariables]
+  [./vx]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[AuxKernels]
+  [./vx_ker]
+    type = TigerDarcyVelocityH
+    pressure = pressure
+    variable =  vx
+    component = x
+  [../]
+[]
+
+[Functions]
+  [./source]
+    type = ParsedFunction
+    value = '10*exp(-5*x)-4*exp(-1*x)'
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+  [./temperature]
+  [../]
+[]
+
+[Kernels]
+  [./H_diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./T_diff]
+    type = TigerThermalDiffusionKernelT
+    variable = temperature
+  [../]
+  [./T_advect]
+    type = TigerThermalAdvectionKernelT
+    variable = temperature
+    pressure = pressure
+  [../]
+  [./H_time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+  [./T_time]
+    type = TigerThermalTimeKernelT
+    variable = temperature
+  [../]
+  [./T_body]
+    type = TigerThermalSourceKernelT
+    variable = temperature
+    function = source
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+# SU/PG is off: its coefficient depends on the velocity, which the Jacobian
+# only approximates, and the adjoint needs the exact Jacobian. Two
+# checkpoints for five steps make the backward sweep recompute steps 1 to 3
+[Executioner]
+  type = TigerAdjointTransient
+  solve_type = NEWTON
+  dt = 0.1
+  end_time = 0.5
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-13
+  petsc_options_iname = '-pc_type -adjoint_pc_type'
+  petsc_options_value = 'lu lu'
+  observable_variables = 'temperature temperature'
+  observable_points = '0.45 0 0  0.75 0 0'
+  observable_names = 'T_045 T_075'
+  parameters = 'UserObjects/matrix_uo1/k0 Materials/matrix_t/lambda'
+  max_checkpoints = 2
+  verify = true
+  verify_tolerance = 1e-4
+[]
+
+[Outputs]
+  exodus = false
+  print_linear_residuals = true
+[]
@@ -0,0 +1,104 @@
+# hydrostatic pressure and conductive temperature of two layers (heat flow
+# 0.06 W/m^2, conductivities 2 and 3 W/m/K, interface at -400 m)
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 20
+  xmax = 100
+  ymin = -1000
+  ymax = 0
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./profile]
+    type = TigerHydrostaticProfile
+    fp_uo = water_uo
+    vertical_component = y
+    top = 0
+    bottom = -1000
+    surface_pressure = 1e5
+    surface_temperature = 283.15
+    heat_flow = 0.06
+    conductivity = '2 3'
+    layer_interfaces = '-400'
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./pressure]
+    type = TigerHydrostaticIC
+    variable = pressure
+    profile = profile
+    quantity = pressure
+  [../]
+  [./temperature]
+    type = TigerHydrostaticIC
+    variable = temperature
+    profile = profile
+    quantity = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./p_250]
+    type = PointValue
+    variable = pressure
+    point = '50 -250 0'
+    execute_on = initial
+  [../]
+  [./p_1000]
+    type = PointValue
+    variable = pressure
+    point = '50 -1000 0'
+    execute_on = initial
+  [../]
+  [./T_250]
+    type = PointValue
+    variable = temperature
+    point = '50 -250 0'
+    execute_on = initial
+  [../]
+  [./T_500]
+    type = PointValue
+    variable = temperature
+    point = '50 -500 0'
+    execute_on = initial
+  [../]
+  [./T_1000]
+    type = PointValue
+    variable = temperature
+    point = '50 -1000 0'
+    execute_on = initial
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = initial
+  [../]
+[]
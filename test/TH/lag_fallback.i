@@ -0,0 +1,100 @@
+# the left temperature jumps by 50 K, so the lagged (Vogel) viscosity of the
+# first step differs by far more than lag_tolerance from the current one:
+# the 10 s step is rejected and repeated as a 5 s step with the full Newton
+# linearisation. The conduction is fast enough for that step to reach the
+# linear steady profile, so the following lagged steps are accepted and the
+# step size grows back to 10 s
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  xmax = 1
+  nx = 4
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerIdealWater
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./rock_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0.5
+    specific_density = 2600
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    temperature = temperature
+    fp_uo = water_uo
+    lagged = true
+    lag_tolerance = 1e-2
+  [../]
+  [./rock_t]
+    type = TigerThermalMaterialT
+    advection_type = pure_diffusion
+    conductivity_type = isotropic
+    lambda = 1e11
+    specific_heat = 1000
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300
+  [../]
+[]
+
+[Kernels]
+  [./T_diff]
+    type = TigerThermalDiffusionKernelT
+    variable = temperature
+  [../]
+  [./T_dt]
+    type = TigerThermalTimeKernelT
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = FunctionDirichletBC
+    variable = temperature
+    boundary = left
+    function = 'if(t>0,350,300)'
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 300
+  [../]
+[]
+
+[Postprocessors]
+  [./T_mid]
+    type = PointValue
+    variable = temperature
+    point = '0.5 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  end_time = 30
+  [./TimeStepper]
+    type = ConstantDT
+    dt = 10
+    growth_factor = 2
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
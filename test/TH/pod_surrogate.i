@@ -0,0 +1,39 @@
+# Reduced-order surrogate of the production temperature trained from six
+# runs (injection rate, injection temperature) and evaluated for a new pair
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+[]
+
+[Problem]
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[UserObjects]
+  [./pod]
+    type = TigerPODSurrogate
+    training_files = 'pod_training/run_0.csv pod_training/run_1.csv
+                      pod_training/run_2.csv pod_training/run_3.csv
+                      pod_training/run_4.csv pod_training/run_5.csv'
+    training_parameters = '10 40; 10 70; 20 40; 20 70; 30 40; 30 70'
+    curve = T_production
+    benchmark_evaluations = 10
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./curve]
+    type = TigerPODSurrogateCurve
+    surrogate = pod
+    parameters = '25 55'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
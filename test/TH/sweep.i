@@ -0,0 +1,60 @@
+# Batch-restore sweep over the controllable k0, lambda and mass_flux of
+# sweep_sub.i; every parameter takes two values, so each of them changes the
+# well pressure or temperature between some pair of rows
+[StochasticTools]
+[]
+
+[Samplers]
+  [./sample]
+    type = CartesianProduct
+    # k0, lambda, mass_flux
+    linear_space_items = '1e-14 1e-14 2
+                          2 1 2
+                          1 1 2'
+    execute_on = PRE_MULTIAPP_SETUP
+  [../]
+[]
+
+[MultiApps]
+  [./runner]
+    type = SamplerFullSolveMultiApp
+    input_files = 'sweep_sub.i'
+    sampler = sample
+    mode = batch-restore
+  [../]
+[]
+
+[Transfers]
+  [./parameters]
+    type = SamplerParameterTransfer
+    multi_app = runner
+    sampler = sample
+    parameters = 'UserObjects/matrix_uo/k0 Materials/matrix_t/lambda DiracKernels/well/mass_flux'
+    to_control = 'stochastic'
+  [../]
+  [./p_well]
+    type = SamplerPostprocessorTransfer
+    multi_app = runner
+    sampler = sample
+    to_vector_postprocessor = results
+    from_postprocessor = 'p_well'
+  [../]
+  [./T_well]
+    type = SamplerPostprocessorTransfer
+    multi_app = runner
+    sampler = sample
+    to_vector_postprocessor = results
+    from_postprocessor = 'T_well'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./results]
+    type = StochasticResults
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  execute_on = 'FINAL'
+[]
@@ -0,0 +1,135 @@
+# 1D steady well between two fixed boundaries, solved for every row of
+# sweep.i; k0, lambda and mass_flux are set through the SamplerReceiver.
+# With L = 2, rho = 1000 and mu = 1e-3 the values at the well are
+#   p = 1.5e8 - mass_flux * mu / (2 * rho * k0)
+#   T = 300 + source * L^2 / (8 * lambda) = 300 + 3 / lambda
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+  xmax = 2
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./matrix_uo]
+    type = TigerPermeabilityConst
+    permeability_type = isotropic
+    k0 = '1.0e-14'
+  [../]
+[]
+
+[Materials]
+  [./matrix_g]
+    type = TigerGeometryMaterial
+  [../]
+  [./matrix_p]
+    type = TigerPorosityMaterial
+    porosity = 0
+    specific_density = 2600
+  [../]
+  [./matrix_f]
+    type = TigerFluidMaterial
+    pressure = pressure
+    temperature = temperature
+    fp_uo = water_uo
+  [../]
+  [./matrix_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    kf_uo = matrix_uo
+    compressibility = 1.0e-10
+  [../]
+  [./matrix_t]
+    type = TigerThermalMaterialT
+    advection_type = pure_diffusion
+    conductivity_type = isotropic
+    lambda = 2
+    specific_heat = 1000
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+    initial_condition = 1.5e8
+  [../]
+  [./temperature]
+    initial_condition = 300
+  [../]
+[]
+
+[BCs]
+  [./p]
+    type = DirichletBC
+    variable = pressure
+    boundary = 'left right'
+    value = 1.5e8
+  [../]
+  [./T]
+    type = DirichletBC
+    variable = temperature
+    boundary = 'left right'
+    value = 300
+  [../]
+[]
+
+[DiracKernels]
+  [./well]
+    type = TigerHydraulicPointSourceH
+    point = '1 0 0'
+    mass_flux = 1.0
+    variable = pressure
+  [../]
+[]
+
+[Kernels]
+  [./H_diff]
+    type = TigerHydraulicKernelH
+    variable = pressure
+  [../]
+  [./T_diff]
+    type = TigerThermalDiffusionKernelT
+    variable = temperature
+  [../]
+  [./T_source]
+    type = TigerThermalSourceKernelT
+    variable = temperature
+    value = 6
+  [../]
+[]
+
+[Postprocessors]
+  [./p_well]
+    type = PointValue
+    variable = pressure
+    point = '1 0 0'
+  [../]
+  [./T_well]
+    type = PointValue
+    variable = temperature
+    point = '1 0 0'
+  [../]
+[]
+
+[Controls]
+  [./stochastic]
+    type = SamplerReceiver
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  console = false
+[]
@@ -0,0 +1,215 @@
+# Fixed-stress split of 3d_THM_T_P.i (as sample_problems/fixed_stress): the
+# pressure / temperature solve with frozen displacements and the mechanics
+# sub-application (fixed_stress_mechanics.i) alternate until the Picard
+# iterations converge. The converged split is compared with the gold of the
+# monolithic test.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 10
+  nz = 2
+  ymax = 0
+  ymin = -1
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerWaterConst
+      viscosity = 0.001
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type = TigerPermeabilityVar
+    permeability_type = isotropic
+    k0 = '1.0e-12'
+    n0 = 0.2
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+  [./temp]
+    initial_condition = 373.15
+  [../]
+[]
+
+[AuxVariables]
+  # displacements of the mechanics sub-application
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./disp_z]
+  [../]
+  # pressure of the previous fixed-stress iteration
+  [./p_k]
+  [../]
+[]
+
+[AuxKernels]
+  [./p_k]
+    type = ParsedAux
+    variable = p_k
+    function = 'pressure'
+    args = 'pressure'
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Kernels]
+  [./hm]
+    type = TigerHydroMechanicsKernelHM
+    variable = pressure
+  [../]
+  [./hm_time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+  [../]
+  [./fixed_stress]
+    type = TigerFixedStressKernelHM
+    variable = pressure
+    previous_iterate = p_k
+    # E / (3 (1 - 2 nu)) of the mechanics sub-application
+    drained_bulk_modulus = 1.6667e7
+  [../]
+  [./t]
+    type = TigerThermalTimeKernelT
+    variable = temp
+  [../]
+  [./t_time]
+    type = TigerThermalDiffusionKernelT
+    variable = temp
+  [../]
+[]
+
+[BCs]
+  [./pressure]
+    type =  DirichletBC
+    variable = pressure
+    boundary = top
+    value = 0
+  [../]
+  [./temp]
+    type = FunctionDirichletBC
+    variable = temp
+    boundary = top
+    function = if(x>0.5&z>0.5&t>5000,320,373.15)
+  [../]
+[]
+
+[Materials]
+  # strains of the frozen displacements
+  [./strain]
+    type = ComputeIncrementalSmallStrain
+    displacements = 'disp_x disp_y disp_z'
+  [../]
+  [./rock_g]
+    type = TigerGeometryMaterial
+    gravity = '0 0 0'
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    porosity = 0.2
+    specific_density = 2500
+    porosity_evolution = true
+  [../]
+  [./rock_m]
+    type = TigerMechanicsMaterialM
+    incremental = true
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 1.0e-9
+    kf_uo = rock_uo
+  [../]
+  [./rock_t]
+    type = TigerThermalMaterialT
+    specific_heat = 850
+    lambda = 2
+    conductivity_type = isotropic
+    advection_type = pure_diffusion
+  [../]
+[]
+
+[MultiApps]
+  [./mechanics]
+    type = TransientMultiApp
+    input_files = fixed_stress_mechanics.i
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./pressure]
+    type = MultiAppCopyTransfer
+    direction = to_multiapp
+    multi_app = mechanics
+    source_variable = pressure
+    variable = pressure
+  [../]
+  [./temp]
+    type = MultiAppCopyTransfer
+    direction = to_multiapp
+    multi_app = mechanics
+    source_variable = temp
+    variable = temp
+  [../]
+  [./disp_x]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_x
+    variable = disp_x
+  [../]
+  [./disp_y]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_y
+    variable = disp_y
+  [../]
+  [./disp_z]
+    type = MultiAppCopyTransfer
+    direction = from_multiapp
+    multi_app = mechanics
+    source_variable = disp_z
+    variable = disp_z
+  [../]
+[]
+
+[Preconditioning]
+  [./p1]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  end_time = 50000
+  dt = 5000
+  solve_type = NEWTON
+  nl_abs_tol = 1e-10
+  l_max_its = 20
+  automatic_scaling = true
+  picard_max_its = 50
+  picard_rel_tol = 1e-8
+  picard_abs_tol = 1e-10
+[]
+
+[Outputs]
+  file_base = 3d_THM_T_P_out
+  exodus = true
+  print_linear_residuals = false
+[]
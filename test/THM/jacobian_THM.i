@@ -0,0 +1,186 @@
+# Jacobian check of the temperature couplings of the hydraulic kernels (run
+# with -snes_test_jacobian by the PetscJacobianTester). The porosity evolves
+# with pressure, temperature and strain, the viscosity and density depend on
+# temperature and the permeability on porosity (Kozeny-Carman). The fluid and
+# solid conductivities are equal, so the mixture conductivity of the heat
+# equation does not depend on porosity.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Modules]
+  [./TensorMechanics]
+    [./Master]
+      [./all]
+      add_variables = true
+      strain = SMALL
+      incremental = true
+      [../]
+    [../]
+  [../]
+  [./FluidProperties]
+    [./water_uo]
+      type = TigerIdealWater
+      bulk_modulus = 10
+      reference_pressure = 0
+      thermal_expansion = 1e-2
+      thermal_conductivity = 2
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./rock_uo]
+    type = TigerPermeabilityVar
+    permeability_type = isotropic
+    k0 = '1.0e-3'
+    n0 = 0.2
+  [../]
+[]
+
+[Variables]
+  [./pressure]
+  [../]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./pressure]
+    type = RandomIC
+    variable = pressure
+    min = 0.05
+    max = 0.2
+  [../]
+  [./temperature]
+    type = RandomIC
+    variable = temperature
+    min = 300
+    max = 310
+  [../]
+  [./disp_x]
+    type = RandomIC
+    variable = disp_x
+    min = -1e-2
+    max = 1e-2
+  [../]
+  [./disp_y]
+    type = RandomIC
+    variable = disp_y
+    min = -1e-2
+    max = 1e-2
+  [../]
+  [./disp_z]
+    type = RandomIC
+    variable = disp_z
+    min = -1e-2
+    max = 1e-2
+  [../]
+[]
+
+[Kernels]
+  [./hm]
+    type = TigerHydroMechanicsKernelHM
+    variable = pressure
+    temperature = temperature
+  [../]
+  [./hm_time]
+    type = TigerHydraulicTimeKernelH
+    variable = pressure
+    temperature = temperature
+  [../]
+  [./t_diff]
+    type = TigerThermalDiffusionKernelT
+    variable = temperature
+  [../]
+  [./poro_x]
+    type = PoroMechanicsCoupling
+    variable = disp_x
+    porepressure = pressure
+    component = 0
+  [../]
+  [./poro_y]
+    type = PoroMechanicsCoupling
+    variable = disp_y
+    porepressure = pressure
+    component = 1
+  [../]
+  [./poro_z]
+    type = PoroMechanicsCoupling
+    variable = disp_z
+    porepressure = pressure
+    component = 2
+  [../]
+[]
+
+[Materials]
+  [./Elasticity_tensor]
+    type = ComputeElasticityTensor
+    fill_method = symmetric_isotropic_E_nu
+    C_ijkl = '1 0.25'
+  [../]
+  [./stress]
+    type = ComputeFiniteStrainElasticStress
+  [../]
+  [./rock_g]
+    type = TigerGeometryMaterial
+    gravity = '0 0 -1e-3'
+  [../]
+  [./rock_p]
+    type = TigerPorosityMaterial
+    pressure = pressure
+    temperature = temperature
+    porosity = 0.2
+    specific_density = 2500
+    porosity_evolution = true
+    thermal_expansion_coeff = 1e-3
+    stress_free_temperature = 300
+  [../]
+  [./rock_m]
+    type = TigerMechanicsMaterialM
+    incremental = true
+    biot_coefficient = 0.6
+    solid_bulk_modulus = 1
+  [../]
+  [./rock_f]
+    type = TigerFluidMaterial
+    pressure = pressure
+    temperature = temperature
+    fp_uo = water_uo
+  [../]
+  [./rock_h]
+    type = TigerHydraulicMaterialH
+    pressure = pressure
+    compressibility = 0.1
+    kf_uo = rock_uo
+  [../]
+  [./rock_t]
+    type = TigerThermalMaterialT
+    specific_heat = 850
+    lambda = 2
+    conductivity_type = isotropic
+    advection_type = pure_diffusion
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 2
+  dt = 1
+[]